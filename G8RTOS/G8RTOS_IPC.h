@@ -9,6 +9,7 @@
 /************************************Includes***************************************/
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "./G8RTOS_Semaphores.h"
 
@@ -19,6 +20,25 @@
 #define FIFO_SIZE 256
 #define MAX_NUMBER_OF_FIFOS 6
 
+// Topic ring size must be a power of two
+#define TOPIC_SIZE 16
+#define MAX_NUMBER_OF_TOPICS 4
+#define MAX_SUBSCRIBERS 4
+
+#define MAX_NUMBER_OF_EXCHANGES 2
+#define MAX_EXCHANGE_BUFFERS 3
+
+// Storage for the reference-counted buffer pool, POOL_NUM_BLOCKS *
+// POOL_BLOCK_SIZE bytes of SRAM. Off by default, the API stays compiled
+// and G8RTOS_AllocBuffer reports an empty pool.
+#ifndef G8RTOS_BUFFER_POOL
+#define G8RTOS_BUFFER_POOL 0
+#endif
+
+// Buffer pool block size in bytes, must be a multiple of 4
+#define POOL_BLOCK_SIZE 400
+#define POOL_NUM_BLOCKS 8
+
 /*************************************Defines***************************************/
 
 /******************************Data Type Definitions********************************/
@@ -35,6 +55,33 @@
 int32_t G8RTOS_InitFIFO(uint32_t FIFO_index);
 int32_t G8RTOS_ReadFIFO(uint32_t FIFO_index);
 int32_t G8RTOS_WriteFIFO(uint32_t FIFO_index, uint32_t data);
+int32_t G8RTOS_SetFIFOWatermark(uint32_t FIFO_index, uint32_t watermark);
+int32_t G8RTOS_WaitFIFO(uint32_t FIFO_index, uint32_t timeoutMS);
+int32_t G8RTOS_ReadFIFOBatch(uint32_t FIFO_index, uint32_t *buffer, uint32_t max);
+int32_t G8RTOS_FlushFIFO(uint32_t FIFO_index);
+int32_t G8RTOS_ReadFIFO_MPMC(uint32_t FIFO_index);
+int32_t G8RTOS_WriteFIFO_MPMC(uint32_t FIFO_index, uint32_t data);
+
+int32_t G8RTOS_InitTopic(uint32_t topic_index);
+int32_t G8RTOS_Subscribe(uint32_t topic_index);
+int32_t G8RTOS_Publish(uint32_t topic_index, uint32_t data);
+int32_t G8RTOS_ReadTopic(uint32_t topic_index, int32_t subscriber);
+int32_t G8RTOS_DrainTopic(uint32_t topic_index, int32_t subscriber);
+uint32_t G8RTOS_GetTopicLostData(uint32_t topic_index, int32_t subscriber);
+
+int32_t G8RTOS_InitExchange(uint32_t exchange_index, void *buffers[], uint32_t num_buffers);
+void *G8RTOS_ExchangeFillBuffer(uint32_t exchange_index);
+void *G8RTOS_ExchangePublish(uint32_t exchange_index);
+void *G8RTOS_ExchangeAcquire(uint32_t exchange_index);
+int32_t G8RTOS_ExchangeRelease(uint32_t exchange_index);
+uint32_t G8RTOS_GetExchangeOverruns(uint32_t exchange_index);
+
+int32_t G8RTOS_InitBufferPool(void);
+int32_t G8RTOS_AllocBuffer(void);
+void *G8RTOS_GetBuffer(int32_t handle);
+int32_t G8RTOS_RetainBuffer(int32_t handle);
+int32_t G8RTOS_ReleaseBuffer(int32_t handle);
+uint32_t G8RTOS_GetFreeBuffers(void);
 
 /********************************Public Functions***********************************/
 
@@ -0,0 +1,56 @@
+// G8RTOS_IPCStress.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// On-target stress test for the multi-producer/multi-consumer FIFO calls
+
+#ifndef G8RTOS_IPCSTRESS_H_
+#define G8RTOS_IPCSTRESS_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Messages each producer sends, numbered 0..IPC_STRESS_COUNT-1
+#define IPC_STRESS_COUNT        2048
+
+// Messages a producer writes before sleeping. Bursts longer than
+// FIFO_SIZE overflow the FIFO so lost writes get exercised too.
+#define IPC_STRESS_BURST        320
+#define IPC_STRESS_SLEEP_MS     4
+
+// Time without progress after the producers finish before the monitor
+// gives up on the missing messages
+#define IPC_STRESS_TIMEOUT_MS   1000
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Outcome of the run. It passes if no message came twice, each consumer
+// saw each producer's messages in order, and every message that did not
+// arrive was one the FIFO turned away.
+typedef struct IPCStress_Result_t {
+    uint32_t received;          // messages read by the consumers
+    uint32_t rejected;          // writes the FIFO reported full
+    uint32_t missing;           // messages never received
+    uint32_t duplicates;        // messages received more than once
+    uint32_t outOfOrder;        // messages older than the last one a consumer saw from that producer
+    bool done;
+    bool passed;
+} IPCStress_Result_t;
+
+/******************************Data Type Definitions********************************/
+
+/********************************Public Functions***********************************/
+
+int32_t IPCStress_Init(uint32_t FIFO_index);
+void IPCStress_GetResult(IPCStress_Result_t *result);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_IPCSTRESS_H_ */
@@ -49,6 +49,7 @@ typedef enum
 /********************************Public Variables***********************************/
 
 extern tcb_t* CurrentlyRunningThread;
+extern uint32_t SystemTime;
 
 /********************************Public Variables***********************************/
 
@@ -9,6 +9,7 @@
 /************************************Includes***************************************/
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /************************************Includes***************************************/
 
@@ -31,6 +32,7 @@ typedef int32_t semaphore_t;
 void G8RTOS_InitSemaphore(semaphore_t* s, int32_t value);
 void G8RTOS_WaitSemaphore(semaphore_t* s);
 void G8RTOS_SignalSemaphore(semaphore_t* s);
+bool G8RTOS_WaitSemaphoreTimeout(semaphore_t* s, uint32_t timeoutMS);
 
 /********************************Public Functions***********************************/
 
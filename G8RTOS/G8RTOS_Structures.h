@@ -39,6 +39,8 @@ typedef struct tcb_t {
     semaphore_t *blocked;
     uint32_t sleepCount;
     bool asleep;
+    bool timedBlock;
+    bool timedOut;
     uint8_t priority;
     bool isAlive;
     char threadName[MAX_NAME_LENGTH];
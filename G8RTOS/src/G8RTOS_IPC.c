@@ -8,9 +8,17 @@
 /************************************Includes***************************************/
 
 #include "../G8RTOS_Semaphores.h"
+#include "../G8RTOS_CriticalSection.h"
 
 /************************************Includes***************************************/
 
+/*************************************Defines***************************************/
+
+#define EXCHANGE_NONE (-1)
+#define POOL_NONE (-1)
+
+/*************************************Defines***************************************/
+
 /******************************Data Type Definitions********************************/
 
 
@@ -23,10 +31,48 @@ typedef struct G8RTOS_FIFO_t {
     uint32_t *head;
     uint32_t *tail;
     uint32_t lost_data;
+    uint32_t count;
     semaphore_t currentSize;
     semaphore_t mutex;
+    uint32_t watermark;
+    bool watermarkWaiting;
+    semaphore_t watermarkReached;
 } G8RTOS_FIFO_t;
 
+// Each subscriber keeps its own read cursor into the shared ring, so
+// published data is stored once no matter how many threads consume it.
+typedef struct G8RTOS_Topic_t {
+    uint32_t buffer[TOPIC_SIZE];
+    uint32_t writeIndex;
+    uint32_t readIndex[MAX_SUBSCRIBERS];
+    uint32_t lost_data[MAX_SUBSCRIBERS];
+    semaphore_t available[MAX_SUBSCRIBERS];
+    uint32_t numSubscribers;
+} G8RTOS_Topic_t;
+
+// Buffer exchange (double/triple buffering). Buffers never move, only the
+// indices saying who owns which one are swapped.
+typedef struct G8RTOS_Exchange_t {
+    void *buffers[MAX_EXCHANGE_BUFFERS];
+    int8_t fill;
+    int8_t ready;
+    int8_t consume;
+    uint8_t freeList[MAX_EXCHANGE_BUFFERS];
+    uint8_t numFree;
+    uint32_t overruns;
+    semaphore_t readySem;
+} G8RTOS_Exchange_t;
+
+// Fixed-block buffer pool. Blocks are handed around by index (handle) so
+// they fit in a FIFO or topic word, and freed when the last reference goes.
+// The block memory itself is PoolBlocks, only there with G8RTOS_BUFFER_POOL.
+typedef struct G8RTOS_BufferPool_t {
+    uint8_t refCount[POOL_NUM_BLOCKS];
+    int8_t nextFree[POOL_NUM_BLOCKS];
+    int8_t freeHead;
+    uint32_t numFree;
+} G8RTOS_BufferPool_t;
+
 /****************************Data Structure Definitions*****************************/
 
 /***********************************Externs*****************************************/
@@ -36,6 +82,16 @@ typedef struct G8RTOS_FIFO_t {
 
 static G8RTOS_FIFO_t FIFOs[MAX_NUMBER_OF_FIFOS] = {0};
 
+static G8RTOS_Topic_t Topics[MAX_NUMBER_OF_TOPICS] = {0};
+
+static G8RTOS_Exchange_t Exchanges[MAX_NUMBER_OF_EXCHANGES] = {0};
+
+static G8RTOS_BufferPool_t BufferPool = {0};
+
+#if G8RTOS_BUFFER_POOL
+static uint32_t PoolBlocks[POOL_NUM_BLOCKS][POOL_BLOCK_SIZE / 4];
+#endif
+
 /********************************Public Variables***********************************/
 
 /********************************Public Functions***********************************/
@@ -52,8 +108,12 @@ int32_t G8RTOS_InitFIFO(uint32_t FIFO_index) {
         FIFOs[FIFO_index].head = &(FIFOs[FIFO_index].buffer[0]);
         FIFOs[FIFO_index].tail = &(FIFOs[FIFO_index].buffer[0]);
         FIFOs[FIFO_index].lost_data = 0;
+        FIFOs[FIFO_index].count = 0;
         G8RTOS_InitSemaphore(&FIFOs[FIFO_index].currentSize, 0);
         G8RTOS_InitSemaphore(&FIFOs[FIFO_index].mutex, 1);
+        FIFOs[FIFO_index].watermark = 0;
+        FIFOs[FIFO_index].watermarkWaiting = 0;
+        G8RTOS_InitSemaphore(&FIFOs[FIFO_index].watermarkReached, 0);
 
         return 0;
     }
@@ -119,7 +179,605 @@ int32_t G8RTOS_WriteFIFO(uint32_t FIFO_index, uint32_t data) {
     // Increase current size
     G8RTOS_SignalSemaphore(&(FIFOs[FIFO_index].currentSize));
 
+    // Only wake a batch reader once enough data has built up
+    if (FIFOs[FIFO_index].watermarkWaiting &&
+        FIFOs[FIFO_index].currentSize >= (int32_t)FIFOs[FIFO_index].watermark) {
+        FIFOs[FIFO_index].watermarkWaiting = 0;
+        G8RTOS_SignalSemaphore(&(FIFOs[FIFO_index].watermarkReached));
+    }
+
+    return 0;
+}
+
+// G8RTOS_ReadFIFO_MPMC
+// Reads data from head of a FIFO shared by several readers. Passing the
+// size semaphore reserves one element, the head is then claimed in a short
+// critical section, so readers always get elements in FIFO order no matter
+// which one the scheduler wakes first. Don't mix with G8RTOS_ReadFIFO.
+// Param "FIFO_index": Index of FIFO block
+// Return: int32_t, data at head pointer
+int32_t G8RTOS_ReadFIFO_MPMC(uint32_t FIFO_index) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) {
+        return INT32_MAX;
+    }
+
+    G8RTOS_FIFO_t *fifo = &FIFOs[FIFO_index];
+
+    // Wait if there is no data
+    G8RTOS_WaitSemaphore(&fifo->currentSize);
+
+    int32_t IBit_State = StartCriticalSection();
+
+    int32_t data = *fifo->head;
+
+    fifo->head++;
+    if (fifo->head > &(fifo->buffer[FIFO_SIZE-1])) {
+        fifo->head = &(fifo->buffer[0]);
+    }
+    fifo->count--;
+
+    EndCriticalSection(IBit_State);
+
+    return data;
+}
+
+// G8RTOS_WriteFIFO_MPMC
+// Writes data to tail of a FIFO shared by several writers (threads or
+// aperiodic events). The full check, store and tail update happen in one
+// critical section, so concurrent writers can't claim the same slot.
+// Don't mix with G8RTOS_WriteFIFO.
+// Param "FIFO_index": Index of FIFO block
+// Param "data": Data to write
+// Return: int32_t, -1 if index out of range, -2 if full (data lost), 0 if okay
+int32_t G8RTOS_WriteFIFO_MPMC(uint32_t FIFO_index, uint32_t data) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) {
+        return -1;
+    }
+
+    G8RTOS_FIFO_t *fifo = &FIFOs[FIFO_index];
+
+    int32_t IBit_State = StartCriticalSection();
+
+    // count tracks slots in use, currentSize only tracks unreserved data
+    if (fifo->count >= FIFO_SIZE) {
+        fifo->lost_data++;
+        EndCriticalSection(IBit_State);
+        return -2;
+    }
+
+    *fifo->tail = data;
+
+    fifo->tail++;
+    if (fifo->tail > &(fifo->buffer[FIFO_SIZE-1])) {
+        fifo->tail = &(fifo->buffer[0]);
+    }
+    fifo->count++;
+
+    G8RTOS_SignalSemaphore(&fifo->currentSize);
+
+    EndCriticalSection(IBit_State);
+
+    return 0;
+}
+
+// G8RTOS_SetFIFOWatermark
+// Sets how many elements must be queued before a reader blocked
+// in G8RTOS_WaitFIFO is woken. A FIFO read this way should not also
+// be read with the blocking G8RTOS_ReadFIFO.
+// Param "FIFO_index": Index of FIFO block
+// Param "watermark": Number of elements to wait for, [1..FIFO_SIZE]
+// Return: int32_t, -1 if error, 0 if okay
+int32_t G8RTOS_SetFIFOWatermark(uint32_t FIFO_index, uint32_t watermark) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS || watermark == 0 || watermark > FIFO_SIZE) {
+        return -1;
+    }
+
+    FIFOs[FIFO_index].watermark = watermark;
+
+    return 0;
+}
+
+// G8RTOS_WaitFIFO
+// Blocks until the FIFO holds at least its watermark of elements,
+// it is flushed by the producer, or the timeout expires.
+// Param "FIFO_index": Index of FIFO block
+// Param "timeoutMS": Maximum number of ms to block
+// Return: int32_t, number of elements available (may be below watermark), -1 if error
+int32_t G8RTOS_WaitFIFO(uint32_t FIFO_index, uint32_t timeoutMS) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) {
+        return -1;
+    }
+
+    G8RTOS_FIFO_t *fifo = &FIFOs[FIFO_index];
+
+    int32_t IBit_State = StartCriticalSection();
+
+    if (fifo->currentSize >= (int32_t)fifo->watermark) {
+        EndCriticalSection(IBit_State);
+        return fifo->currentSize;
+    }
+
+    // Drop any stale wake from a previous timed out wait
+    fifo->watermarkReached = 0;
+    fifo->watermarkWaiting = 1;
+
+    EndCriticalSection(IBit_State);
+
+    G8RTOS_WaitSemaphoreTimeout(&fifo->watermarkReached, timeoutMS);
+    fifo->watermarkWaiting = 0;
+
+    return (fifo->currentSize > 0) ? fifo->currentSize : 0;
+}
+
+// G8RTOS_ReadFIFOBatch
+// Reads up to max elements without blocking.
+// Param "FIFO_index": Index of FIFO block
+// Param "buffer": Array to copy elements into
+// Param "max": Size of buffer
+// Return: int32_t, number of elements read, -1 if error
+int32_t G8RTOS_ReadFIFOBatch(uint32_t FIFO_index, uint32_t *buffer, uint32_t max) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) {
+        return -1;
+    }
+
+    G8RTOS_FIFO_t *fifo = &FIFOs[FIFO_index];
+    uint32_t count = 0;
+
+    G8RTOS_WaitSemaphore(&fifo->mutex);
+
+    while (count < max && fifo->currentSize > 0) {
+        buffer[count++] = *fifo->head;
+
+        fifo->head++;
+        if (fifo->head > &(fifo->buffer[FIFO_SIZE-1])) {
+            fifo->head = &(fifo->buffer[0]);
+        }
+
+        // Writers only ever increment currentSize, so this is the only race to guard
+        int32_t IBit_State = StartCriticalSection();
+        fifo->currentSize--;
+        EndCriticalSection(IBit_State);
+    }
+
+    G8RTOS_SignalSemaphore(&fifo->mutex);
+
+    return count;
+}
+
+// G8RTOS_FlushFIFO
+// Wakes a reader blocked in G8RTOS_WaitFIFO even if the watermark
+// has not been reached, e.g. at the end of a burst of samples.
+// Param "FIFO_index": Index of FIFO block
+// Return: int32_t, -1 if error, 0 if okay
+int32_t G8RTOS_FlushFIFO(uint32_t FIFO_index) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) {
+        return -1;
+    }
+
+    int32_t IBit_State = StartCriticalSection();
+
+    if (FIFOs[FIFO_index].watermarkWaiting) {
+        FIFOs[FIFO_index].watermarkWaiting = 0;
+        G8RTOS_SignalSemaphore(&(FIFOs[FIFO_index].watermarkReached));
+    }
+
+    EndCriticalSection(IBit_State);
+
     return 0;
 }
 
+// G8RTOS_InitTopic
+// Initializes a publish/subscribe topic with no subscribers.
+// Param "topic_index": Index of topic block
+// Return: int32_t, -1 if index out of range, 0 if okay
+int32_t G8RTOS_InitTopic(uint32_t topic_index) {
+    if (topic_index >= MAX_NUMBER_OF_TOPICS) {
+        return -1;
+    }
+
+    int32_t IBit_State = StartCriticalSection();
+
+    Topics[topic_index].writeIndex = 0;
+    Topics[topic_index].numSubscribers = 0;
+
+    EndCriticalSection(IBit_State);
+
+    return 0;
+}
+
+// G8RTOS_Subscribe
+// Adds a subscriber to a topic. The subscriber only sees data published
+// after it subscribes.
+// Param "topic_index": Index of topic block
+// Return: int32_t, subscriber ID, -1 if index out of range, -2 if full
+int32_t G8RTOS_Subscribe(uint32_t topic_index) {
+    if (topic_index >= MAX_NUMBER_OF_TOPICS) {
+        return -1;
+    }
+
+    G8RTOS_Topic_t *topic = &Topics[topic_index];
+
+    int32_t IBit_State = StartCriticalSection();
+
+    if (topic->numSubscribers >= MAX_SUBSCRIBERS) {
+        EndCriticalSection(IBit_State);
+        return -2;
+    }
+
+    int32_t subscriber = topic->numSubscribers++;
+    topic->readIndex[subscriber] = topic->writeIndex;
+    topic->lost_data[subscriber] = 0;
+    topic->available[subscriber] = 0;
+
+    EndCriticalSection(IBit_State);
+
+    return subscriber;
+}
+
+// G8RTOS_Publish
+// Writes data once into the topic ring and wakes every subscriber.
+// Never blocks, so it is safe to call from aperiodic/periodic events.
+// A subscriber that has fallen a full ring behind loses its oldest element.
+// Param "topic_index": Index of topic block
+// Param "data": Data to publish
+// Return: int32_t, -1 if index out of range, 0 if okay
+int32_t G8RTOS_Publish(uint32_t topic_index, uint32_t data) {
+    if (topic_index >= MAX_NUMBER_OF_TOPICS) {
+        return -1;
+    }
+
+    G8RTOS_Topic_t *topic = &Topics[topic_index];
+
+    int32_t IBit_State = StartCriticalSection();
+
+    topic->buffer[topic->writeIndex & (TOPIC_SIZE - 1)] = data;
+    topic->writeIndex++;
+
+    for (uint32_t i = 0; i < topic->numSubscribers; i++) {
+        if (topic->writeIndex - topic->readIndex[i] > TOPIC_SIZE) {
+            // Slow subscriber, drop its oldest element instead of blocking
+            topic->readIndex[i]++;
+            topic->lost_data[i]++;
+        } else {
+            G8RTOS_SignalSemaphore(&topic->available[i]);
+        }
+    }
+
+    EndCriticalSection(IBit_State);
+
+    return 0;
+}
+
+// G8RTOS_ReadTopic
+// Reads the next element for a subscriber, blocking if it has
+// already consumed everything published so far.
+// Param "topic_index": Index of topic block
+// Param "subscriber": Subscriber ID returned by G8RTOS_Subscribe
+// Return: int32_t, data at subscriber's cursor
+int32_t G8RTOS_ReadTopic(uint32_t topic_index, int32_t subscriber) {
+    if (topic_index >= MAX_NUMBER_OF_TOPICS ||
+        subscriber < 0 || (uint32_t)subscriber >= Topics[topic_index].numSubscribers) {
+        return INT32_MAX;
+    }
+
+    G8RTOS_Topic_t *topic = &Topics[topic_index];
+
+    // Wait if this subscriber has no new data
+    G8RTOS_WaitSemaphore(&topic->available[subscriber]);
+
+    int32_t IBit_State = StartCriticalSection();
+
+    int32_t data = topic->buffer[topic->readIndex[subscriber] & (TOPIC_SIZE - 1)];
+    topic->readIndex[subscriber]++;
+
+    EndCriticalSection(IBit_State);
+
+    return data;
+}
+
+// G8RTOS_DrainTopic
+// Discards everything pending for a subscriber so its next read only
+// returns data published from now on. Must be called by the subscriber itself.
+// Param "topic_index": Index of topic block
+// Param "subscriber": Subscriber ID returned by G8RTOS_Subscribe
+// Return: int32_t, -1 if index or subscriber invalid, 0 if okay
+int32_t G8RTOS_DrainTopic(uint32_t topic_index, int32_t subscriber) {
+    if (topic_index >= MAX_NUMBER_OF_TOPICS ||
+        subscriber < 0 || (uint32_t)subscriber >= Topics[topic_index].numSubscribers) {
+        return -1;
+    }
+
+    G8RTOS_Topic_t *topic = &Topics[topic_index];
+
+    int32_t IBit_State = StartCriticalSection();
+
+    topic->readIndex[subscriber] = topic->writeIndex;
+    topic->available[subscriber] = 0;
+
+    EndCriticalSection(IBit_State);
+
+    return 0;
+}
+
+// G8RTOS_GetTopicLostData
+// Gets how many elements a subscriber missed by falling behind.
+// Param "topic_index": Index of topic block
+// Param "subscriber": Subscriber ID returned by G8RTOS_Subscribe
+// Return: uint32_t, number of elements lost
+uint32_t G8RTOS_GetTopicLostData(uint32_t topic_index, int32_t subscriber) {
+    if (topic_index >= MAX_NUMBER_OF_TOPICS ||
+        subscriber < 0 || (uint32_t)subscriber >= Topics[topic_index].numSubscribers) {
+        return 0;
+    }
+
+    return Topics[topic_index].lost_data[subscriber];
+}
+
+// G8RTOS_InitExchange
+// Initializes a buffer exchange. The producer starts out owning the first
+// buffer, the rest are free. Use 2 buffers for ping-pong, 3 so the producer
+// never has to wait on a slow consumer.
+// Param "exchange_index": Index of exchange block
+// Param "buffers": Array of pointers to equally sized buffers
+// Param "num_buffers": Number of buffers, [2..MAX_EXCHANGE_BUFFERS]
+// Return: int32_t, -1 if error, 0 if okay
+int32_t G8RTOS_InitExchange(uint32_t exchange_index, void *buffers[], uint32_t num_buffers) {
+    if (exchange_index >= MAX_NUMBER_OF_EXCHANGES ||
+        num_buffers < 2 || num_buffers > MAX_EXCHANGE_BUFFERS) {
+        return -1;
+    }
+
+    G8RTOS_Exchange_t *exchange = &Exchanges[exchange_index];
+
+    int32_t IBit_State = StartCriticalSection();
+
+    for (uint32_t i = 0; i < num_buffers; i++) {
+        exchange->buffers[i] = buffers[i];
+    }
+
+    exchange->fill = 0;
+    exchange->ready = EXCHANGE_NONE;
+    exchange->consume = EXCHANGE_NONE;
+    exchange->numFree = 0;
+    for (uint32_t i = num_buffers - 1; i > 0; i--) {
+        exchange->freeList[exchange->numFree++] = i;
+    }
+    exchange->overruns = 0;
+    exchange->readySem = 0;
+
+    EndCriticalSection(IBit_State);
+
+    return 0;
+}
+
+// G8RTOS_ExchangeFillBuffer
+// Gets the buffer the producer currently owns.
+// Param "exchange_index": Index of exchange block
+// Return: void*, buffer to fill, 0 if error
+void *G8RTOS_ExchangeFillBuffer(uint32_t exchange_index) {
+    if (exchange_index >= MAX_NUMBER_OF_EXCHANGES) {
+        return 0;
+    }
+
+    return Exchanges[exchange_index].buffers[Exchanges[exchange_index].fill];
+}
+
+// G8RTOS_ExchangePublish
+// Hands the filled buffer to the consumer and gives the producer a new
+// one to fill. Never blocks, so it can be called from an aperiodic event
+// (e.g. ADC or uDMA done). If the consumer has not picked up the previous
+// buffer it is replaced by this one, and if no buffer is free the data
+// is dropped; both count as an overrun.
+// Param "exchange_index": Index of exchange block
+// Return: void*, next buffer to fill, 0 if error
+void *G8RTOS_ExchangePublish(uint32_t exchange_index) {
+    if (exchange_index >= MAX_NUMBER_OF_EXCHANGES) {
+        return 0;
+    }
+
+    G8RTOS_Exchange_t *exchange = &Exchanges[exchange_index];
+
+    int32_t IBit_State = StartCriticalSection();
+
+    if (exchange->ready != EXCHANGE_NONE) {
+        // Consumer is behind, newest data wins and the old one gets refilled
+        int8_t old = exchange->ready;
+        exchange->ready = exchange->fill;
+        exchange->fill = old;
+        exchange->overruns++;
+    } else if (exchange->numFree > 0) {
+        exchange->ready = exchange->fill;
+        exchange->fill = exchange->freeList[--exchange->numFree];
+        G8RTOS_SignalSemaphore(&exchange->readySem);
+    } else {
+        // Consumer still holds the only other buffer, refill this one
+        exchange->overruns++;
+    }
+
+    void *next = exchange->buffers[exchange->fill];
+
+    EndCriticalSection(IBit_State);
+
+    return next;
+}
+
+// G8RTOS_ExchangeAcquire
+// Releases the buffer the consumer was holding and blocks until
+// the producer publishes a new one.
+// Param "exchange_index": Index of exchange block
+// Return: void*, buffer the consumer now owns, 0 if error
+void *G8RTOS_ExchangeAcquire(uint32_t exchange_index) {
+    if (exchange_index >= MAX_NUMBER_OF_EXCHANGES) {
+        return 0;
+    }
+
+    G8RTOS_Exchange_t *exchange = &Exchanges[exchange_index];
+
+    // Give back the old buffer first so the producer can use it while we wait
+    G8RTOS_ExchangeRelease(exchange_index);
+
+    G8RTOS_WaitSemaphore(&exchange->readySem);
+
+    int32_t IBit_State = StartCriticalSection();
+
+    exchange->consume = exchange->ready;
+    exchange->ready = EXCHANGE_NONE;
+    void *buffer = exchange->buffers[exchange->consume];
+
+    EndCriticalSection(IBit_State);
+
+    return buffer;
+}
+
+// G8RTOS_ExchangeRelease
+// Returns the consumer's buffer once it is done with it. Needed with
+// two buffers so the producer has somewhere to go on its next publish.
+// Param "exchange_index": Index of exchange block
+// Return: int32_t, -1 if error, 0 if okay
+int32_t G8RTOS_ExchangeRelease(uint32_t exchange_index) {
+    if (exchange_index >= MAX_NUMBER_OF_EXCHANGES) {
+        return -1;
+    }
+
+    G8RTOS_Exchange_t *exchange = &Exchanges[exchange_index];
+
+    int32_t IBit_State = StartCriticalSection();
+
+    if (exchange->consume != EXCHANGE_NONE) {
+        exchange->freeList[exchange->numFree++] = exchange->consume;
+        exchange->consume = EXCHANGE_NONE;
+    }
+
+    EndCriticalSection(IBit_State);
+
+    return 0;
+}
+
+// G8RTOS_GetExchangeOverruns
+// Gets how many published buffers were dropped or replaced before
+// the consumer picked them up.
+// Param "exchange_index": Index of exchange block
+// Return: uint32_t, number of overruns
+uint32_t G8RTOS_GetExchangeOverruns(uint32_t exchange_index) {
+    if (exchange_index >= MAX_NUMBER_OF_EXCHANGES) {
+        return 0;
+    }
+
+    return Exchanges[exchange_index].overruns;
+}
+
+// G8RTOS_InitBufferPool
+// Puts every pool block on the free list. Without G8RTOS_BUFFER_POOL
+// the free list stays empty.
+// Return: int32_t, 0 if okay
+int32_t G8RTOS_InitBufferPool(void) {
+    int32_t IBit_State = StartCriticalSection();
+
+    for (int32_t i = 0; i < POOL_NUM_BLOCKS; i++) {
+        BufferPool.refCount[i] = 0;
+        BufferPool.nextFree[i] = (i + 1 < POOL_NUM_BLOCKS) ? i + 1 : POOL_NONE;
+    }
+#if G8RTOS_BUFFER_POOL
+    BufferPool.freeHead = 0;
+    BufferPool.numFree = POOL_NUM_BLOCKS;
+#else
+    BufferPool.freeHead = POOL_NONE;
+    BufferPool.numFree = 0;
+#endif
+
+    EndCriticalSection(IBit_State);
+
+    return 0;
+}
+
+// G8RTOS_AllocBuffer
+// Takes a block off the free list with a reference count of 1.
+// O(1) and non-blocking, so it can be called from aperiodic events.
+// Return: int32_t, handle of the block, -1 if the pool is empty
+int32_t G8RTOS_AllocBuffer(void) {
+    int32_t IBit_State = StartCriticalSection();
+
+    int32_t handle = BufferPool.freeHead;
+    if (handle != POOL_NONE) {
+        BufferPool.freeHead = BufferPool.nextFree[handle];
+        BufferPool.refCount[handle] = 1;
+        BufferPool.numFree--;
+    }
+
+    EndCriticalSection(IBit_State);
+
+    return handle;
+}
+
+// G8RTOS_GetBuffer
+// Gets the memory of an allocated block, POOL_BLOCK_SIZE bytes long.
+// Param "handle": Handle returned by G8RTOS_AllocBuffer
+// Return: void*, pointer to block, 0 if handle invalid
+void *G8RTOS_GetBuffer(int32_t handle) {
+    if (handle < 0 || handle >= POOL_NUM_BLOCKS || BufferPool.refCount[handle] == 0) {
+        return 0;
+    }
+
+#if G8RTOS_BUFFER_POOL
+    return PoolBlocks[handle];
+#else
+    return 0;
+#endif
+}
+
+// G8RTOS_RetainBuffer
+// Adds a reference, call once for every extra consumer the handle is sent to.
+// Param "handle": Handle returned by G8RTOS_AllocBuffer
+// Return: int32_t, new reference count, -1 if handle invalid
+int32_t G8RTOS_RetainBuffer(int32_t handle) {
+    if (handle < 0 || handle >= POOL_NUM_BLOCKS) {
+        return -1;
+    }
+
+    int32_t IBit_State = StartCriticalSection();
+
+    int32_t count = -1;
+    if (BufferPool.refCount[handle] != 0 && BufferPool.refCount[handle] < UINT8_MAX) {
+        count = ++BufferPool.refCount[handle];
+    }
+
+    EndCriticalSection(IBit_State);
+
+    return count;
+}
+
+// G8RTOS_ReleaseBuffer
+// Drops a reference, the block goes back to the pool with the last one.
+// Param "handle": Handle returned by G8RTOS_AllocBuffer
+// Return: int32_t, remaining reference count, -1 if handle invalid
+int32_t G8RTOS_ReleaseBuffer(int32_t handle) {
+    if (handle < 0 || handle >= POOL_NUM_BLOCKS) {
+        return -1;
+    }
+
+    int32_t IBit_State = StartCriticalSection();
+
+    int32_t count = -1;
+    if (BufferPool.refCount[handle] != 0) {
+        count = --BufferPool.refCount[handle];
+
+        if (count == 0) {
+            BufferPool.nextFree[handle] = BufferPool.freeHead;
+            BufferPool.freeHead = handle;
+            BufferPool.numFree++;
+        }
+    }
+
+    EndCriticalSection(IBit_State);
+
+    return count;
+}
+
+// G8RTOS_GetFreeBuffers
+// Gets how many blocks are left in the pool.
+// Return: uint32_t, number of free blocks
+uint32_t G8RTOS_GetFreeBuffers(void) {
+    return BufferPool.numFree;
+}
+
 /********************************Public Functions***********************************/
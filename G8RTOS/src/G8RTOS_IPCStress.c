@@ -0,0 +1,237 @@
+// G8RTOS_IPCStress.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Two producers and two consumers hammer one FIFO through the MPMC calls
+// while a monitor thread checks what came out.
+
+#include "../G8RTOS_IPCStress.h"
+
+/************************************Includes***************************************/
+
+#include "../G8RTOS_IPC.h"
+#include "../G8RTOS_Scheduler.h"
+#include "../G8RTOS_CriticalSection.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define IPC_STRESS_PRODUCERS    2
+#define IPC_STRESS_CONSUMERS    2
+
+// Producer index in the top half of each message, sequence number below
+#define IPC_STRESS_MESSAGE(p, seq)  (((uint32_t)(p) << 16) | (seq))
+
+#define IPC_STRESS_PRIORITY     200
+
+/*************************************Defines***************************************/
+
+/********************************Private Variables**********************************/
+
+static uint32_t stressFIFO;
+
+// One bit per message, set by the consumer that receives it
+static uint8_t seen[IPC_STRESS_PRODUCERS][IPC_STRESS_COUNT / 8];
+
+// Last sequence number each consumer got from each producer, -1 for none
+static int32_t lastSeq[IPC_STRESS_CONSUMERS][IPC_STRESS_PRODUCERS];
+
+static volatile uint32_t producersDone;
+static volatile uint32_t rejected;
+static volatile uint32_t received;
+static volatile uint32_t duplicates;
+static volatile uint32_t outOfOrder;
+
+static IPCStress_Result_t result;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// IPCStress_Produce
+// Writes the producer's numbered messages in bursts. A write the FIFO
+// turns away is counted and skipped, not retried.
+// Param uint32_t "p": producer index.
+// Return: void
+static void IPCStress_Produce(uint32_t p) {
+    for (uint32_t seq = 0; seq < IPC_STRESS_COUNT; seq++) {
+        if (G8RTOS_WriteFIFO_MPMC(stressFIFO, IPC_STRESS_MESSAGE(p, seq)) == -2) {
+            IBit_State = StartCriticalSection();
+            rejected++;
+            EndCriticalSection(IBit_State);
+        }
+
+        if ((seq % IPC_STRESS_BURST) == IPC_STRESS_BURST - 1) {
+            sleep(IPC_STRESS_SLEEP_MS);
+        }
+    }
+
+    IBit_State = StartCriticalSection();
+    producersDone++;
+    EndCriticalSection(IBit_State);
+
+    G8RTOS_KillSelf();
+}
+
+// IPCStress_Consume
+// Reads messages forever and checks each one against what this consumer
+// and the others have already seen.
+// Param uint32_t "c": consumer index.
+// Return: void
+static void IPCStress_Consume(uint32_t c) {
+    while (1) {
+        uint32_t data = (uint32_t)G8RTOS_ReadFIFO_MPMC(stressFIFO);
+        uint32_t p = data >> 16;
+        uint32_t seq = data & 0xFFFF;
+
+        IBit_State = StartCriticalSection();
+
+        received++;
+        if (p >= IPC_STRESS_PRODUCERS || seq >= IPC_STRESS_COUNT) {
+            // Not a message anyone sent, count it with the duplicates
+            duplicates++;
+        } else {
+            if (seen[p][seq / 8] & (1 << (seq % 8))) {
+                duplicates++;
+            }
+            seen[p][seq / 8] |= 1 << (seq % 8);
+
+            // Claims are ordered, so one consumer never sees a producer go back
+            if ((int32_t)seq <= lastSeq[c][p]) {
+                outOfOrder++;
+            }
+            lastSeq[c][p] = seq;
+        }
+
+        EndCriticalSection(IBit_State);
+    }
+}
+
+// IPCStress_Finish
+// Counts the messages that never arrived and fills in the result.
+// Return: void
+static void IPCStress_Finish(void) {
+    uint32_t missing = 0;
+    for (uint32_t p = 0; p < IPC_STRESS_PRODUCERS; p++) {
+        for (uint32_t seq = 0; seq < IPC_STRESS_COUNT; seq++) {
+            if (!(seen[p][seq / 8] & (1 << (seq % 8)))) {
+                missing++;
+            }
+        }
+    }
+
+    result.received = received;
+    result.rejected = rejected;
+    result.missing = missing;
+    result.duplicates = duplicates;
+    result.outOfOrder = outOfOrder;
+    result.passed = (duplicates == 0) && (outOfOrder == 0) && (missing == rejected);
+    result.done = 1;
+}
+
+// IPCStress_Producer0, IPCStress_Producer1
+static void IPCStress_Producer0(void) {
+    IPCStress_Produce(0);
+}
+
+static void IPCStress_Producer1(void) {
+    IPCStress_Produce(1);
+}
+
+// IPCStress_Consumer0, IPCStress_Consumer1
+static void IPCStress_Consumer0(void) {
+    IPCStress_Consume(0);
+}
+
+static void IPCStress_Consumer1(void) {
+    IPCStress_Consume(1);
+}
+
+// IPCStress_Monitor
+// Waits for the producers to finish and the FIFO to drain, then publishes
+// the result. Gives up on messages still missing after IPC_STRESS_TIMEOUT_MS.
+// Return: void
+static void IPCStress_Monitor(void) {
+    uint32_t lastCount = 0;
+    uint32_t idleMS = 0;
+
+    while (1) {
+        sleep(10);
+
+        if (producersDone < IPC_STRESS_PRODUCERS) {
+            continue;
+        }
+
+        uint32_t count = received + rejected;
+        if (count >= IPC_STRESS_PRODUCERS * IPC_STRESS_COUNT) {
+            break;
+        }
+
+        idleMS = (count == lastCount) ? idleMS + 10 : 0;
+        lastCount = count;
+        if (idleMS >= IPC_STRESS_TIMEOUT_MS) {
+            break;
+        }
+    }
+
+    // Let a consumer that was mid-message record it
+    sleep(10);
+    IPCStress_Finish();
+
+    G8RTOS_KillSelf();
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// IPCStress_Init
+// Sets up the FIFO and adds the producer, consumer and monitor threads.
+// Takes five thread slots, so run it in place of the application threads
+// (with only the idle thread next to it). Call before G8RTOS_Launch.
+// Param uint32_t "FIFO_index": FIFO to use, only touched through the MPMC calls.
+// Return: int32_t, 0 if okay, -1 if the FIFO or a thread could not be added.
+int32_t IPCStress_Init(uint32_t FIFO_index) {
+    if (G8RTOS_InitFIFO(FIFO_index) != 0) {
+        return -1;
+    }
+    stressFIFO = FIFO_index;
+
+    for (uint32_t p = 0; p < IPC_STRESS_PRODUCERS; p++) {
+        for (uint32_t i = 0; i < IPC_STRESS_COUNT / 8; i++) {
+            seen[p][i] = 0;
+        }
+        for (uint32_t c = 0; c < IPC_STRESS_CONSUMERS; c++) {
+            lastSeq[c][p] = -1;
+        }
+    }
+    producersDone = 0;
+    rejected = 0;
+    received = 0;
+    duplicates = 0;
+    outOfOrder = 0;
+    result = (IPCStress_Result_t){ 0 };
+
+    // Producers and consumers share a priority so they preempt each other
+    // mid-call on every time slice
+    if (G8RTOS_AddThread(IPCStress_Producer0, IPC_STRESS_PRIORITY, "ipcprod0\0") != NO_ERROR ||
+        G8RTOS_AddThread(IPCStress_Producer1, IPC_STRESS_PRIORITY, "ipcprod1\0") != NO_ERROR ||
+        G8RTOS_AddThread(IPCStress_Consumer0, IPC_STRESS_PRIORITY, "ipccons0\0") != NO_ERROR ||
+        G8RTOS_AddThread(IPCStress_Consumer1, IPC_STRESS_PRIORITY, "ipccons1\0") != NO_ERROR ||
+        G8RTOS_AddThread(IPCStress_Monitor, IPC_STRESS_PRIORITY - 1, "ipcmon\0") != NO_ERROR) {
+        return -1;
+    }
+
+    return 0;
+}
+
+// IPCStress_GetResult
+// Gets the outcome of the run. out->done stays 0 until the monitor
+// has finished checking.
+// Param IPCStress_Result_t* "out": output.
+// Return: void
+void IPCStress_GetResult(IPCStress_Result_t *out) {
+    *out = result;
+}
+
+/********************************Public Functions***********************************/
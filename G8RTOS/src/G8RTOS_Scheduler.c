@@ -81,6 +81,14 @@ void SysTick_Handler() {
     for (int i = 0; i < NumberOfThreads; i++) {
         if (currThread->sleepCount <= SystemTime) {
             currThread->asleep = 0;
+
+            // Timed semaphore wait expired, give back the count it took
+            if (currThread->timedBlock && currThread->blocked) {
+                (*currThread->blocked)++;
+                currThread->blocked = 0;
+                currThread->timedBlock = 0;
+                currThread->timedOut = 1;
+            }
         }
         currThread = currThread->nextTCB;
     }
@@ -192,6 +200,8 @@ sched_ErrCode_t G8RTOS_AddThread(void (*threadToAdd)(void), uint8_t priority, ch
         threadControlBlocks[i].ThreadID = threadCounter++;
         threadControlBlocks[i].asleep = 0;
         threadControlBlocks[i].blocked = 0;
+        threadControlBlocks[i].timedBlock = 0;
+        threadControlBlocks[i].timedOut = 0;
         threadControlBlocks[i].sleepCount = 0;
         threadControlBlocks[i].priority = priority;
         threadControlBlocks[i].isAlive = 1;
@@ -78,8 +78,38 @@ void G8RTOS_SignalSemaphore(semaphore_t* s) {
         }
 
         CurrentlyConsideredThread->blocked = 0;
+        CurrentlyConsideredThread->timedBlock = 0;
     }
     EndCriticalSection(IBit_State);
 }
 
+// G8RTOS_WaitSemaphoreTimeout
+// Same as G8RTOS_WaitSemaphore, but gives up after timeoutMS system ticks.
+// On timeout the SysTick handler returns the count it took and unblocks the thread.
+// Param "s": Pointer to semaphore
+// Param "timeoutMS": Maximum number of ms to stay blocked
+// Return: bool, true if the semaphore was acquired, false if timed out
+bool G8RTOS_WaitSemaphoreTimeout(semaphore_t* s, uint32_t timeoutMS) {
+    int32_t IBit_State = StartCriticalSection();
+    (*s)--;
+
+    if ((*s) < 0) {
+        volatile tcb_t *self = CurrentlyRunningThread;
+
+        self->blocked = s;
+        self->sleepCount = SystemTime + timeoutMS;
+        self->timedOut = 0;
+        self->timedBlock = 1;
+        EndCriticalSection(IBit_State);
+        // yield, and stay here until signaled or timed out
+        HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+        while (self->blocked);
+
+        return !self->timedOut;
+    }
+
+    EndCriticalSection(IBit_State);
+    return true;
+}
+
 /********************************Public Functions***********************************/
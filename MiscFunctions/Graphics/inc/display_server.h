@@ -0,0 +1,78 @@
+// display_server.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Display server: threads queue draw commands, one thread owns the SPI bus
+
+#ifndef DISPLAY_SERVER_H_
+#define DISPLAY_SERVER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../../../G8RTOS/G8RTOS_Semaphores.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DISPLAY_QUEUE_SIZE      32
+#define DISPLAY_TEXT_MAX        12
+
+// Fills at least this many pixels go through uDMA instead of the CPU
+#define DISPLAY_DMA_MIN_PIXELS  256
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    DISPLAY_CMD_RECT = 0,
+    DISPLAY_CMD_HLINE,
+    DISPLAY_CMD_VLINE,
+    DISPLAY_CMD_TEXT,
+    DISPLAY_CMD_BLIT,
+    DISPLAY_CMD_TILES
+} DisplayCmdType_t;
+
+// One queued draw command
+typedef struct DisplayCmd_t {
+    uint8_t type;
+    uint8_t size;
+    int16_t x, y;
+    int16_t w, h;
+    uint16_t color;
+    uint16_t bg;
+    union {
+        char text[DISPLAY_TEXT_MAX];
+        const uint16_t *pixels;
+    } data;
+} DisplayCmd_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void DisplayServer_Init(semaphore_t *bus);
+void DisplayServer_Thread(void);
+
+void DisplayServer_Submit(const DisplayCmd_t *cmd);
+void DisplayServer_Rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void DisplayServer_HLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+void DisplayServer_VLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+void DisplayServer_Text(int16_t x, int16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t size);
+void DisplayServer_Blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+void DisplayServer_FlushTiles(void);
+uint32_t DisplayServer_Pending(void);
+
+/********************************Public Functions***********************************/
+
+
+#endif /* DISPLAY_SERVER_H_ */
@@ -0,0 +1,70 @@
+// frame_pacer.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Frame pacing from the ST7789 TE output or a timer, with frame statistics
+
+#ifndef FRAME_PACER_H_
+#define FRAME_PACER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Set to 1 once the TE pin is wired to FRAME_TE_GPIO_BASE/FRAME_TE_PIN,
+// otherwise frames are timed by a periodic event every FRAME_PACER_PERIOD_MS
+#define FRAME_PACER_USE_TE      0
+
+#define FRAME_PACER_PERIOD_MS   20
+
+// TE pulses at the panel refresh rate (~60 Hz), only every Nth is a frame slot
+#define FRAME_PACER_TE_DIVIDER  1
+
+#define FRAME_TE_PERIPH         SYSCTL_PERIPH_GPIOC
+#define FRAME_TE_GPIO_BASE      GPIO_PORTC_BASE
+#define FRAME_TE_PIN            GPIO_PIN_6
+#define FRAME_TE_INTERRUPT      INT_GPIOC
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef struct FramePacerStats_t {
+    uint32_t frames;            // frame slots waited for
+    uint32_t missed;            // slots that went by while drawing
+    uint32_t lastFrameMS;       // time between the last two frames
+    uint32_t minFrameMS;
+    uint32_t maxFrameMS;
+    uint32_t avgFrameMS;
+    uint32_t lastWorkMS;        // time spent drawing before the last wait
+    uint32_t maxWorkMS;
+} FramePacerStats_t;
+
+/******************************Data Type Definitions********************************/
+
+/********************************Public Functions***********************************/
+
+void FramePacer_Init(void);
+void FramePacer_WaitFrame(void);
+void FramePacer_GetStats(FramePacerStats_t *stats);
+void FramePacer_ResetStats(void);
+
+/********************************Public Functions***********************************/
+
+/********************************Periodic Threads***********************************/
+
+void FramePacer_Tick(void);
+
+/********************************Periodic Threads***********************************/
+
+/*******************************Aperiodic Threads***********************************/
+
+void FramePacer_TE_Handler(void);
+
+/*******************************Aperiodic Threads***********************************/
+
+#endif /* FRAME_PACER_H_ */
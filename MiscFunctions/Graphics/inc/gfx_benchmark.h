@@ -0,0 +1,48 @@
+// gfx_benchmark.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Measures SPI traffic and time of the GFX fill primitives
+
+#ifndef GFX_BENCHMARK_H_
+#define GFX_BENCHMARK_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// SystemTime only counts milliseconds, so each primitive is drawn this many times
+#define GFX_BENCH_REPEAT        20
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    GFX_BENCH_CIRCLE = 0,
+    GFX_BENCH_ROUNDRECT,
+    GFX_BENCH_TRIANGLE,
+    GFX_BENCH_COUNT
+} GFXBenchPrimitive_t;
+
+// Cost of one draw of a primitive
+typedef struct GFXBenchResult_t {
+    uint32_t windows;
+    uint32_t bytes;
+    uint32_t timeUS;
+    uint32_t busUS;             // part of timeUS with the display selected
+} GFXBenchResult_t;
+
+/******************************Data Type Definitions********************************/
+
+/********************************Public Functions***********************************/
+
+void GFX_Benchmark_Run(GFXBenchResult_t results[GFX_BENCH_COUNT]);
+
+/********************************Public Functions***********************************/
+
+#endif /* GFX_BENCHMARK_H_ */
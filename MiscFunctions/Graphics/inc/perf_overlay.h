@@ -0,0 +1,54 @@
+// perf_overlay.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Per-frame display bus statistics with an optional corner overlay
+
+#ifndef PERF_OVERLAY_H_
+#define PERF_OVERLAY_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Set to 1 to draw FPS, ms/frame, KB/frame and bus ms/frame in a corner
+#define PERF_OVERLAY_SHOW       0
+
+// Statistics are averaged over frames in windows of this length
+#define PERF_OVERLAY_PERIOD_MS  500
+
+// First line of the overlay, the others go down the screen
+#define PERF_OVERLAY_X          2
+#define PERF_OVERLAY_Y          270
+#define PERF_OVERLAY_SPACING    10
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Averages over the last full period
+typedef struct PerfStats_t {
+    uint32_t fps10;             // frames per second, times 10
+    uint32_t frameUS;           // time per frame
+    uint32_t busUS;             // time per frame with the display selected
+    uint32_t bytes;             // bus bytes per frame, commands and pixels
+    uint32_t commandBytes;      // command and parameter bytes per frame
+    uint32_t windows;           // window setups per frame
+} PerfStats_t;
+
+/******************************Data Type Definitions********************************/
+
+/********************************Public Functions***********************************/
+
+void PerfOverlay_Init(void);
+void PerfOverlay_Frame(void);
+void PerfOverlay_GetStats(PerfStats_t *stats);
+void PerfOverlay_SetVisible(bool visible);
+
+/********************************Public Functions***********************************/
+
+#endif /* PERF_OVERLAY_H_ */
@@ -0,0 +1,50 @@
+// sprite.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Run-length encoded palette sprites stored in flash
+
+#ifndef SPRITE_H_
+#define SPRITE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Sprite_t.key when every palette entry is drawn
+#define SPRITE_NO_KEY           0xFF
+
+// Runs of different rows the blitter can merge at once
+#define SPRITE_OPEN_RUNS        8
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Each row is a list of (count, palette index) byte pairs adding up to
+// w, runs never cross rows. rows[] holds the byte offset of every row
+// so any row can be decoded on its own. Made by tools/sprite_convert.py.
+typedef struct Sprite_t {
+    uint8_t w;
+    uint8_t h;
+    uint8_t key;
+    uint8_t colors;
+    const uint16_t *palette;
+    const uint16_t *rows;
+    const uint8_t *data;
+} Sprite_t;
+
+/******************************Data Type Definitions********************************/
+
+/********************************Public Functions***********************************/
+
+void Sprite_Draw(const Sprite_t *sprite, int16_t x, int16_t y);
+void Sprite_ComposeRow(const Sprite_t *sprite, uint8_t row, int16_t x0, int16_t x1, uint16_t *out);
+
+/********************************Public Functions***********************************/
+
+#endif /* SPRITE_H_ */
@@ -0,0 +1,39 @@
+// strip_chart.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Scrolling strip chart, one row of the display per sample
+
+#ifndef STRIP_CHART_H_
+#define STRIP_CHART_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Samples run along y using hardware scrolling, values along x
+typedef struct StripChart_t {
+    uint16_t top;
+    uint16_t height;
+    int32_t min;
+    int32_t max;
+    uint16_t color;
+    uint16_t bg;
+    int16_t prevX;
+} StripChart_t;
+
+/******************************Data Type Definitions********************************/
+
+/********************************Public Functions***********************************/
+
+void StripChart_Init(StripChart_t *chart, uint16_t top, uint16_t height, int32_t min, int32_t max,
+                     uint16_t color, uint16_t bg);
+void StripChart_Push(StripChart_t *chart, int32_t value);
+
+/********************************Public Functions***********************************/
+
+#endif /* STRIP_CHART_H_ */
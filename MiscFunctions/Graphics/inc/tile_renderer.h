@@ -0,0 +1,97 @@
+// tile_renderer.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Retained display list rendered through dirty 16x16 tiles
+
+#ifndef TILE_RENDERER_H_
+#define TILE_RENDERER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../../../MultimodDrivers/multimod_ST7789.h"
+#include "./sprite.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// A full 240x280 RGB565 frame does not fit in SRAM, only two tiles do
+#define TILE_SIZE           16
+#define TILE_COLS           ((X_MAX + TILE_SIZE - 1) / TILE_SIZE)
+#define TILE_ROWS           ((Y_MAX + TILE_SIZE - 1) / TILE_SIZE)
+#define TILE_COUNT          (TILE_COLS * TILE_ROWS)
+
+#define TILE_MAX_ITEMS      40
+#define TILE_TEXT_MAX       12
+
+// Collision grid, each cell keeps a bit per item overlapping it
+#define TILE_GRID_SIZE      40
+#define TILE_GRID_COLS      ((X_MAX + TILE_GRID_SIZE - 1) / TILE_GRID_SIZE)
+#define TILE_GRID_ROWS      ((Y_MAX + TILE_GRID_SIZE - 1) / TILE_GRID_SIZE)
+
+#if TILE_MAX_ITEMS > 64
+#error "TILE_MAX_ITEMS must fit in the 64-bit collision grid cells"
+#endif
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    TILE_ITEM_NONE = 0,
+    TILE_ITEM_RECT,
+    TILE_ITEM_TEXT,
+    TILE_ITEM_SPRITE
+} TileItemType_t;
+
+// One entry of the display list, later entries are drawn on top
+typedef struct TileItem_t {
+    uint8_t type;
+    bool visible;
+    uint8_t size;
+    int16_t x, y;
+    int16_t w, h;
+    uint16_t color;
+    uint16_t bg;
+    char text[TILE_TEXT_MAX + 1];
+    const Sprite_t *sprite;
+} TileItem_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TileRenderer_Init(uint16_t color);
+
+int32_t TileRenderer_AddRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+int32_t TileRenderer_AddText(int16_t x, int16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t size);
+int32_t TileRenderer_AddSprite(int16_t x, int16_t y, const Sprite_t *sprite);
+
+int32_t TileRenderer_SetRect(int32_t item, int16_t x, int16_t y, int16_t w, int16_t h);
+int32_t TileRenderer_SetColor(int32_t item, uint16_t color);
+int32_t TileRenderer_SetText(int32_t item, const char *str);
+int32_t TileRenderer_SetSprite(int32_t item, const Sprite_t *sprite);
+int32_t TileRenderer_SetVisible(int32_t item, bool visible);
+
+uint32_t TileRenderer_Query(int16_t x, int16_t y, int16_t w, int16_t h, int32_t *hits, uint32_t maxHits);
+uint32_t TileRenderer_Collide(int32_t item, int32_t *hits, uint32_t maxHits);
+
+void TileRenderer_Invalidate(int16_t x, int16_t y, int16_t w, int16_t h);
+void TileRenderer_InvalidateAll(void);
+uint32_t TileRenderer_Flush(void);
+
+uint32_t TileRenderer_GetTilesSent(void);
+uint32_t TileRenderer_GetBytesSent(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* TILE_RENDERER_H_ */
@@ -0,0 +1,77 @@
+// widget.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Retained widget tree drawn through the tile renderer
+
+#ifndef WIDGET_H_
+#define WIDGET_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./tile_renderer.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define WIDGET_MAX          16
+#define WIDGET_LIST_ROWS    5
+#define WIDGET_ROOT         -1
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    WIDGET_GROUP = 0,
+    WIDGET_PANEL,
+    WIDGET_LABEL,
+    WIDGET_NUMBER,
+    WIDGET_PROGRESS,
+    WIDGET_LIST
+} WidgetType_t;
+
+// One node of the tree. Children are added after their parent, so they
+// sit above it in the display list, and are hidden along with it.
+typedef struct Widget_t {
+    uint8_t type;
+    bool visible;
+    int8_t parent;
+    uint8_t count;
+    int8_t items[WIDGET_LIST_ROWS];
+    int16_t x, y, w, h;
+    int32_t max;
+    const char *prefix;
+} Widget_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void Widget_Init(void);
+
+int32_t Widget_AddGroup(int32_t parent);
+int32_t Widget_AddPanel(int32_t parent, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+int32_t Widget_AddLabel(int32_t parent, int16_t x, int16_t y, const char *text, uint16_t color, uint16_t bg, uint8_t size);
+int32_t Widget_AddNumber(int32_t parent, int16_t x, int16_t y, const char *prefix, uint16_t color, uint16_t bg, uint8_t size);
+int32_t Widget_AddProgress(int32_t parent, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t bg, int32_t max);
+int32_t Widget_AddList(int32_t parent, int16_t x, int16_t y, uint8_t rows, int16_t spacing, uint16_t color, uint16_t bg, uint8_t size);
+
+int32_t Widget_SetText(int32_t widget, const char *str);
+int32_t Widget_SetValue(int32_t widget, int32_t value);
+int32_t Widget_SetRowText(int32_t widget, uint8_t row, const char *str);
+int32_t Widget_SetRowNumber(int32_t widget, uint8_t row, int32_t value);
+int32_t Widget_SetVisible(int32_t widget, bool visible);
+
+/********************************Public Functions***********************************/
+
+#endif /* WIDGET_H_ */
@@ -0,0 +1,247 @@
+// display_server.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Display server: threads queue draw commands, one thread owns the SPI bus
+
+/************************************Includes***************************************/
+
+#include "../inc/display_server.h"
+#include "../inc/tile_renderer.h"
+
+#include "../../../G8RTOS/G8RTOS_Scheduler.h"
+#include "../../../G8RTOS/G8RTOS_CriticalSection.h"
+#include "../../../MultimodDrivers/multimod_ST7789.h"
+#include "../../../MultimodDrivers/GFX_Library.h"
+
+/************************************Includes***************************************/
+
+/********************************Private Variables**********************************/
+
+// Command ring. Producers claim a slot in a short critical section and
+// copy into it outside of it, so nobody ever waits on the SPI bus to queue.
+static DisplayCmd_t queue[DISPLAY_QUEUE_SIZE];
+static volatile bool slotReady[DISPLAY_QUEUE_SIZE];
+static uint32_t head = 0;
+static uint32_t tail = 0;
+
+static semaphore_t pending;
+static semaphore_t freeSlots;
+
+// Optional bus lock held for each batch, in case anything else draws directly
+static semaphore_t *busSemaphore = 0;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// DisplayServer_Execute
+// Runs one command on the display.
+// Param DisplayCmd_t* "cmd": command to run.
+// Return: void
+static void DisplayServer_Execute(const DisplayCmd_t *cmd) {
+    switch (cmd->type) {
+    case DISPLAY_CMD_RECT:
+        if ((int32_t)cmd->w * cmd->h >= DISPLAY_DMA_MIN_PIXELS) {
+            ST7789_DMA_FillRectangle(cmd->x, cmd->y, cmd->w, cmd->h, cmd->color);
+        } else {
+            ST7789_DrawRectangle(cmd->x, cmd->y, cmd->w, cmd->h, cmd->color);
+        }
+        break;
+
+    case DISPLAY_CMD_HLINE:
+        ST7789_DrawHLine(cmd->x, cmd->y, cmd->w, cmd->color);
+        break;
+
+    case DISPLAY_CMD_VLINE:
+        ST7789_DrawVLine(cmd->x, cmd->y, cmd->h, cmd->color);
+        break;
+
+    case DISPLAY_CMD_TEXT: {
+        uint8_t len = 0;
+        while (len < DISPLAY_TEXT_MAX && cmd->data.text[len] != '\0') {
+            len++;
+        }
+        display_drawString(cmd->x, cmd->y, cmd->data.text, len, cmd->color, cmd->bg, cmd->size);
+        break;
+    }
+
+    case DISPLAY_CMD_BLIT:
+        ST7789_DMA_Blit(cmd->x, cmd->y, cmd->w, cmd->h, cmd->data.pixels);
+        break;
+
+    case DISPLAY_CMD_TILES:
+        TileRenderer_Flush();
+        break;
+
+    default:
+        break;
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// DisplayServer_Init
+// Initializes the command queue. Call before G8RTOS_Launch.
+// Param semaphore_t* "bus": semaphore to hold while drawing, 0 if the server owns the bus.
+// Return: void
+void DisplayServer_Init(semaphore_t *bus) {
+    head = 0;
+    tail = 0;
+    for (uint32_t i = 0; i < DISPLAY_QUEUE_SIZE; i++) {
+        slotReady[i] = 0;
+    }
+
+    busSemaphore = bus;
+    G8RTOS_InitSemaphore(&pending, 0);
+    G8RTOS_InitSemaphore(&freeSlots, DISPLAY_QUEUE_SIZE);
+}
+
+// DisplayServer_Thread
+// Background thread that owns the display. Sleeps until commands are
+// queued, then runs everything queued so far while holding the bus once.
+// Return: void
+void DisplayServer_Thread(void) {
+    while (1) {
+        G8RTOS_WaitSemaphore(&pending);
+
+        if (busSemaphore) {
+            G8RTOS_WaitSemaphore(busSemaphore);
+        }
+
+        while (1) {
+            // A producer that claimed this slot earlier may still be copying
+            while (!slotReady[head]) {
+                sleep(1);
+            }
+
+            DisplayServer_Execute(&queue[head]);
+
+            slotReady[head] = 0;
+            head = (head + 1) % DISPLAY_QUEUE_SIZE;
+            G8RTOS_SignalSemaphore(&freeSlots);
+
+            // Keep the batch going while there is more, we are the only one decrementing
+            if (pending <= 0) {
+                break;
+            }
+            G8RTOS_WaitSemaphore(&pending);
+        }
+
+        if (busSemaphore) {
+            G8RTOS_SignalSemaphore(busSemaphore);
+        }
+    }
+}
+
+// DisplayServer_Submit
+// Queues a command, only blocks if the queue is full.
+// Param DisplayCmd_t* "cmd": command to copy into the queue.
+// Return: void
+void DisplayServer_Submit(const DisplayCmd_t *cmd) {
+    G8RTOS_WaitSemaphore(&freeSlots);
+
+    int32_t IBit_State = StartCriticalSection();
+    uint32_t slot = tail;
+    tail = (tail + 1) % DISPLAY_QUEUE_SIZE;
+    EndCriticalSection(IBit_State);
+
+    queue[slot] = *cmd;
+    slotReady[slot] = 1;
+
+    G8RTOS_SignalSemaphore(&pending);
+}
+
+// DisplayServer_Rect
+// Queues a filled rectangle.
+// Return: void
+void DisplayServer_Rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    DisplayCmd_t cmd = {
+        .type = DISPLAY_CMD_RECT, .x = x, .y = y, .w = w, .h = h, .color = color
+    };
+    DisplayServer_Submit(&cmd);
+}
+
+// DisplayServer_HLine
+// Queues a horizontal line.
+// Return: void
+void DisplayServer_HLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    DisplayCmd_t cmd = {
+        .type = DISPLAY_CMD_HLINE, .x = x, .y = y, .w = w, .color = color
+    };
+    DisplayServer_Submit(&cmd);
+}
+
+// DisplayServer_VLine
+// Queues a vertical line.
+// Return: void
+void DisplayServer_VLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    DisplayCmd_t cmd = {
+        .type = DISPLAY_CMD_VLINE, .x = x, .y = y, .h = h, .color = color
+    };
+    DisplayServer_Submit(&cmd);
+}
+
+// DisplayServer_Text
+// Queues a string. Strings longer than DISPLAY_TEXT_MAX are split
+// over several commands. Text is transparent if color == bg.
+// Param int16_t "x", "y": cursor position of first character.
+// Param char* "str": null terminated string, copied into the queue.
+// Param uint16_t "color", "bg": text and background colors.
+// Param uint8_t "size": text magnification.
+// Return: void
+void DisplayServer_Text(int16_t x, int16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t size) {
+    DisplayCmd_t cmd = {
+        .type = DISPLAY_CMD_TEXT, .y = y, .size = size, .color = color, .bg = bg
+    };
+
+    while (*str != '\0') {
+        uint32_t len = 0;
+        while (len < DISPLAY_TEXT_MAX && str[len] != '\0') {
+            cmd.data.text[len] = str[len];
+            len++;
+        }
+        if (len < DISPLAY_TEXT_MAX) {
+            cmd.data.text[len] = '\0';
+        }
+
+        cmd.x = x;
+        DisplayServer_Submit(&cmd);
+
+        str += len;
+        x += len * size * 6;
+    }
+}
+
+// DisplayServer_Blit
+// Queues a block of RGB565 pixels, sent by uDMA. The pixels are not
+// copied and must stay valid until the server has drawn them.
+// Return: void
+void DisplayServer_Blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+    DisplayCmd_t cmd = {
+        .type = DISPLAY_CMD_BLIT, .x = x, .y = y, .w = w, .h = h
+    };
+    cmd.data.pixels = pixels;
+    DisplayServer_Submit(&cmd);
+}
+
+// DisplayServer_FlushTiles
+// Queues sending the dirty tiles of the tile renderer, after everything
+// queued before it.
+// Return: void
+void DisplayServer_FlushTiles(void) {
+    DisplayCmd_t cmd = {
+        .type = DISPLAY_CMD_TILES
+    };
+    DisplayServer_Submit(&cmd);
+}
+
+// DisplayServer_Pending
+// Gets the number of commands waiting to be drawn.
+// Return: uint32_t
+uint32_t DisplayServer_Pending(void) {
+    return (pending > 0) ? pending : 0;
+}
+
+/********************************Public Functions***********************************/
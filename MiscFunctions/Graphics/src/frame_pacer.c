@@ -0,0 +1,166 @@
+// frame_pacer.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Frame pacing from the ST7789 TE output or a timer, with frame statistics
+
+/************************************Includes***************************************/
+
+#include "../inc/frame_pacer.h"
+
+#include "../../../G8RTOS/G8RTOS_Scheduler.h"
+#include "../../../G8RTOS/G8RTOS_Semaphores.h"
+#include "../../../G8RTOS/G8RTOS_CriticalSection.h"
+#include "../../../MultimodDrivers/multimod_ST7789.h"
+
+#include <inc/hw_memmap.h>
+#include <inc/hw_ints.h>
+#include <driverlib/gpio.h>
+#include <driverlib/sysctl.h>
+
+/************************************Includes***************************************/
+
+/********************************Private Variables**********************************/
+
+// Frame slots so far, counted by the tick
+static volatile uint32_t frameCount = 0;
+static volatile bool frameWaiting = 0;
+static semaphore_t frameSem;
+
+static uint32_t teCount = 0;
+
+// Frame slot and time the last wait returned
+static uint32_t lastFrame = 0;
+static uint32_t lastReturnMS = 0;
+
+static FramePacerStats_t stats;
+
+/********************************Private Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+// FramePacer_Init
+// Sets up the frame slot source. With FRAME_PACER_USE_TE the display
+// is told to output TE at vertical blanking and FramePacer_TE_Handler
+// has to be added on FRAME_TE_INTERRUPT, otherwise FramePacer_Tick has
+// to be added as a periodic event every FRAME_PACER_PERIOD_MS.
+// Return: void
+void FramePacer_Init(void) {
+    frameCount = 0;
+    frameWaiting = 0;
+    teCount = 0;
+    lastFrame = 0;
+    lastReturnMS = 0;
+    G8RTOS_InitSemaphore(&frameSem, 0);
+    FramePacer_ResetStats();
+
+#if FRAME_PACER_USE_TE
+    SysCtlPeripheralEnable(FRAME_TE_PERIPH);
+    GPIOPinTypeGPIOInput(FRAME_TE_GPIO_BASE, FRAME_TE_PIN);
+    GPIOIntTypeSet(FRAME_TE_GPIO_BASE, FRAME_TE_PIN, GPIO_RISING_EDGE);
+    GPIOIntClear(FRAME_TE_GPIO_BASE, FRAME_TE_PIN);
+    GPIOIntEnable(FRAME_TE_GPIO_BASE, FRAME_TE_PIN);
+
+    ST7789_SetTearingEffect(1);
+#endif
+}
+
+// FramePacer_WaitFrame
+// Sleeps until the next frame slot. Call once per frame right before
+// sending it, slots that went by since the last call count as missed.
+// Return: void
+void FramePacer_WaitFrame(void) {
+    uint32_t workMS = SystemTime - lastReturnMS;
+
+    int32_t IBit_State = StartCriticalSection();
+    uint32_t now = frameCount;
+    frameWaiting = 1;
+    EndCriticalSection(IBit_State);
+
+    if (stats.frames > 0) {
+        stats.missed += now - lastFrame;
+        stats.lastWorkMS = workMS;
+        if (workMS > stats.maxWorkMS) {
+            stats.maxWorkMS = workMS;
+        }
+    }
+
+    G8RTOS_WaitSemaphore(&frameSem);
+
+    uint32_t returnMS = SystemTime;
+    if (stats.frames > 0) {
+        uint32_t frameMS = returnMS - lastReturnMS;
+        stats.lastFrameMS = frameMS;
+        if (frameMS < stats.minFrameMS) {
+            stats.minFrameMS = frameMS;
+        }
+        if (frameMS > stats.maxFrameMS) {
+            stats.maxFrameMS = frameMS;
+        }
+        // Seed the average with the first interval instead of pulling it up from 0
+        if (stats.frames == 1) {
+            stats.avgFrameMS = frameMS;
+        } else {
+            stats.avgFrameMS = (stats.avgFrameMS * 7 + frameMS) / 8;
+        }
+    }
+
+    stats.frames++;
+    lastFrame = frameCount;
+    lastReturnMS = returnMS;
+}
+
+// FramePacer_GetStats
+// Copies the frame statistics.
+// Param FramePacerStats_t* "out": statistics, returned.
+// Return: void
+void FramePacer_GetStats(FramePacerStats_t *out) {
+    *out = stats;
+}
+
+// FramePacer_ResetStats
+// Clears the frame statistics.
+// Return: void
+void FramePacer_ResetStats(void) {
+    stats.frames = 0;
+    stats.missed = 0;
+    stats.lastFrameMS = 0;
+    stats.minFrameMS = UINT32_MAX;
+    stats.maxFrameMS = 0;
+    stats.avgFrameMS = 0;
+    stats.lastWorkMS = 0;
+    stats.maxWorkMS = 0;
+}
+
+/********************************Public Functions***********************************/
+
+/********************************Periodic Threads***********************************/
+
+// FramePacer_Tick
+// Starts a frame slot and wakes the thread waiting for it.
+// Return: void
+void FramePacer_Tick(void) {
+    frameCount++;
+
+    if (frameWaiting) {
+        frameWaiting = 0;
+        G8RTOS_SignalSemaphore(&frameSem);
+    }
+}
+
+/********************************Periodic Threads***********************************/
+
+/*******************************Aperiodic Threads***********************************/
+
+// FramePacer_TE_Handler
+// TE rising edge, the panel has just finished scanning out a frame.
+// Return: void
+void FramePacer_TE_Handler(void) {
+    GPIOIntClear(FRAME_TE_GPIO_BASE, FRAME_TE_PIN);
+
+    if (++teCount >= FRAME_PACER_TE_DIVIDER) {
+        teCount = 0;
+        FramePacer_Tick();
+    }
+}
+
+/*******************************Aperiodic Threads***********************************/
@@ -0,0 +1,78 @@
+// gfx_benchmark.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Measures SPI traffic and time of the GFX fill primitives
+
+/************************************Includes***************************************/
+
+#include "../inc/gfx_benchmark.h"
+
+#include "../../../G8RTOS/G8RTOS_Scheduler.h"
+#include "../../../MultimodDrivers/multimod_ST7789.h"
+#include "../../../MultimodDrivers/GFX_Library.h"
+
+/************************************Includes***************************************/
+
+/*******************************Private Functions***********************************/
+
+// GFX_Benchmark_Draw
+// Draws one primitive at a fixed size.
+// Param uint8_t "primitive": GFXBenchPrimitive_t.
+// Param uint16_t "color": fill color.
+// Return: void
+static void GFX_Benchmark_Draw(uint8_t primitive, uint16_t color) {
+    switch (primitive) {
+    case GFX_BENCH_CIRCLE:
+        display_fillCircle(X_MAX / 2, Y_MAX / 2, 60, color);
+        break;
+
+    case GFX_BENCH_ROUNDRECT:
+        display_fillRoundRect(40, 80, 160, 120, 16, color);
+        break;
+
+    case GFX_BENCH_TRIANGLE:
+        display_fillTriangle(20, 250, 120, 30, 220, 200, color);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// GFX_Benchmark_Run
+// Draws each fill primitive GFX_BENCH_REPEAT times and records the
+// average windows, bytes and time per draw. Build once with GFX_SPAN_FILL
+// set to 0 to get the numbers for the original line fills. Must run in
+// a thread holding the SPI bus, with nothing of higher priority busy,
+// and leaves the screen drawn over.
+// Param GFXBenchResult_t* "results": GFX_BENCH_COUNT entries.
+// Return: void
+void GFX_Benchmark_Run(GFXBenchResult_t results[GFX_BENCH_COUNT]) {
+    for (uint8_t p = 0; p < GFX_BENCH_COUNT; p++) {
+        ST7789Stats_t before, after;
+
+        // Deltas, the counters keep running for the perf overlay
+        ST7789_GetStats(&before);
+        uint32_t start = SystemTime;
+
+        for (uint32_t i = 0; i < GFX_BENCH_REPEAT; i++) {
+            GFX_Benchmark_Draw(p, (i & 1) ? ST7789_WHITE : ST7789_BLUE);
+        }
+
+        uint32_t elapsed = SystemTime - start;
+        ST7789_GetStats(&after);
+
+        uint32_t bytes = (after.commandBytes + after.pixelBytes) - (before.commandBytes + before.pixelBytes);
+        results[p].windows = (after.windows - before.windows) / GFX_BENCH_REPEAT;
+        results[p].bytes = bytes / GFX_BENCH_REPEAT;
+        results[p].timeUS = (elapsed * 1000) / GFX_BENCH_REPEAT;
+        results[p].busUS = ((after.busyCycles - before.busyCycles) / (SysCtlClockGet() / 1000000)) /
+                           GFX_BENCH_REPEAT;
+    }
+}
+
+/********************************Public Functions***********************************/
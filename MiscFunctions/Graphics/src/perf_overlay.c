@@ -0,0 +1,146 @@
+// perf_overlay.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Per-frame display bus statistics with an optional corner overlay
+
+/************************************Includes***************************************/
+
+#include "../inc/perf_overlay.h"
+#include "../inc/widget.h"
+
+#include "../../../G8RTOS/G8RTOS_Scheduler.h"
+#include "../../../MultimodDrivers/multimod_ST7789.h"
+
+#include <driverlib/sysctl.h>
+
+/************************************Includes***************************************/
+
+/********************************Private Variables**********************************/
+
+static PerfStats_t stats;
+
+// Counters at the start of the current period
+static ST7789Stats_t periodStart;
+static uint32_t periodStartMS = 0;
+static uint32_t periodFrames = 0;
+
+static int32_t overlay = WIDGET_ROOT;
+static int32_t lines[4];
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// PerfOverlay_Format
+// Writes a prefix and a number with one decimal, e.g. "MS 20.1".
+// Param char* "buf": at least TILE_TEXT_MAX + 1 characters.
+// Param char* "prefix": short text in front of the number.
+// Param uint32_t "tenths": value times 10.
+// Return: void
+static void PerfOverlay_Format(char *buf, const char *prefix, uint32_t tenths) {
+    char digits[10];
+    uint32_t n = 0;
+    uint32_t len = 0;
+
+    while (*prefix != '\0' && len < TILE_TEXT_MAX - 4) {
+        buf[len++] = *prefix++;
+    }
+
+    do {
+        digits[n++] = '0' + (tenths % 10);
+        tenths /= 10;
+    } while ((tenths || n < 2) && n < sizeof(digits));
+
+    while (n > 1 && len < TILE_TEXT_MAX - 2) {
+        buf[len++] = digits[--n];
+    }
+    buf[len++] = '.';
+    buf[len++] = digits[0];
+    buf[len] = '\0';
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// PerfOverlay_Init
+// Starts the first period and, with PERF_OVERLAY_SHOW, adds the overlay
+// widgets. Call after the rest of the screen so the overlay is on top.
+// Return: void
+void PerfOverlay_Init(void) {
+    ST7789_GetStats(&periodStart);
+    periodStartMS = SystemTime;
+    periodFrames = 0;
+
+#if PERF_OVERLAY_SHOW
+    overlay = Widget_AddGroup(WIDGET_ROOT);
+    for (uint8_t i = 0; i < 4; i++) {
+        lines[i] = Widget_AddLabel(overlay, PERF_OVERLAY_X, PERF_OVERLAY_Y - i * PERF_OVERLAY_SPACING, "",
+                                   ST7789_WHITE, ST7789_BLACK, 1);
+    }
+#endif
+}
+
+// PerfOverlay_Frame
+// Counts a frame. Call once per frame, e.g. after FramePacer_WaitFrame.
+// Once a period has gone by its averages are stored and the overlay,
+// if there is one, is updated. Its text goes out with the next flush.
+// Return: void
+void PerfOverlay_Frame(void) {
+    periodFrames++;
+
+    uint32_t elapsed = SystemTime - periodStartMS;
+    if (elapsed < PERF_OVERLAY_PERIOD_MS) {
+        return;
+    }
+
+    ST7789Stats_t now;
+    ST7789_GetStats(&now);
+
+    uint32_t frames = periodFrames;
+    uint32_t cyclesPerUS = SysCtlClockGet() / 1000000;
+    uint32_t commandBytes = now.commandBytes - periodStart.commandBytes;
+    uint32_t pixelBytes = now.pixelBytes - periodStart.pixelBytes;
+
+    stats.fps10 = (frames * 10000) / elapsed;
+    stats.frameUS = (elapsed * 1000) / frames;
+    stats.busUS = ((now.busyCycles - periodStart.busyCycles) / cyclesPerUS) / frames;
+    stats.bytes = (commandBytes + pixelBytes) / frames;
+    stats.commandBytes = commandBytes / frames;
+    stats.windows = (now.windows - periodStart.windows) / frames;
+
+    periodStart = now;
+    periodStartMS += elapsed;
+    periodFrames = 0;
+
+    if (overlay != WIDGET_ROOT) {
+        char text[TILE_TEXT_MAX + 1];
+
+        PerfOverlay_Format(text, "FPS ", stats.fps10);
+        Widget_SetText(lines[0], text);
+        PerfOverlay_Format(text, "MS ", stats.frameUS / 100);
+        Widget_SetText(lines[1], text);
+        PerfOverlay_Format(text, "KB ", (stats.bytes * 10) / 1024);
+        Widget_SetText(lines[2], text);
+        PerfOverlay_Format(text, "BUS ", stats.busUS / 100);
+        Widget_SetText(lines[3], text);
+    }
+}
+
+// PerfOverlay_GetStats
+// Gets the averages of the last full period.
+// Param PerfStats_t* "out": output.
+// Return: void
+void PerfOverlay_GetStats(PerfStats_t *out) {
+    *out = stats;
+}
+
+// PerfOverlay_SetVisible
+// Shows or hides the overlay, if it was built with PERF_OVERLAY_SHOW.
+// Param bool "visible": true to show.
+// Return: void
+void PerfOverlay_SetVisible(bool visible) {
+    Widget_SetVisible(overlay, visible);
+}
+
+/********************************Public Functions***********************************/
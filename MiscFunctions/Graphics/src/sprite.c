@@ -0,0 +1,178 @@
+// sprite.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Run-length encoded palette sprites stored in flash
+
+/************************************Includes***************************************/
+
+#include "../inc/sprite.h"
+
+#include "../../../MultimodDrivers/multimod_ST7789.h"
+
+/************************************Includes***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Opaque run being grown down the screen while rows keep repeating it
+typedef struct SpriteRun_t {
+    int16_t x0, x1;
+    int16_t y, rows;
+    uint16_t color;
+} SpriteRun_t;
+
+/******************************Data Type Definitions********************************/
+
+/********************************Private Variables**********************************/
+
+static SpriteRun_t openRuns[SPRITE_OPEN_RUNS];
+static uint8_t numOpenRuns = 0;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// Sprite_FlushRun
+// Sends one open run as a single window and removes it.
+// Param uint8_t "index": open run to send.
+// Return: void
+static void Sprite_FlushRun(uint8_t index) {
+    SpriteRun_t *run = &openRuns[index];
+    int16_t w = run->x1 - run->x0 + 1;
+
+    ST7789_BeginWindow(run->x0, run->y, w, run->rows);
+    ST7789_WriteColor(run->color, (uint32_t)w * run->rows);
+
+    openRuns[index] = openRuns[--numOpenRuns];
+}
+
+// Sprite_AddRun
+// Adds an opaque span, growing an open run if the row above had the
+// same span in the same color.
+// Param int16_t "y": row on screen.
+// Param int16_t "x0", "x1": first and last column, already clipped.
+// Param uint16_t "color": color of the span.
+// Return: void
+static void Sprite_AddRun(int16_t y, int16_t x0, int16_t x1, uint16_t color) {
+    for (uint8_t i = 0; i < numOpenRuns; i++) {
+        SpriteRun_t *run = &openRuns[i];
+        if (run->x0 == x0 && run->x1 == x1 && run->color == color && run->y + run->rows == y) {
+            run->rows++;
+            return;
+        }
+    }
+
+    if (numOpenRuns == SPRITE_OPEN_RUNS) {
+        Sprite_FlushRun(0);
+    }
+
+    openRuns[numOpenRuns++] = (SpriteRun_t) {
+        .x0 = x0, .x1 = x1, .y = y, .rows = 1, .color = color
+    };
+}
+
+// Sprite_EndRow
+// Sends every open run the row just decoded did not continue.
+// Param int16_t "y": row just decoded.
+// Return: void
+static void Sprite_EndRow(int16_t y) {
+    uint8_t i = 0;
+    while (i < numOpenRuns) {
+        if (openRuns[i].y + openRuns[i].rows <= y) {
+            Sprite_FlushRun(i);
+        } else {
+            i++;
+        }
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// Sprite_Draw
+// Decodes a sprite straight into display windows. Runs that repeat on
+// the next row are merged, so a sprite made of solid blocks costs about
+// the same as drawing those blocks as rectangles. Transparent runs are
+// skipped and the sprite is clipped to the screen. Caller must hold the
+// SPI bus.
+// Param Sprite_t* "sprite": sprite to draw.
+// Param int16_t "x", "y": top left corner.
+// Return: void
+void Sprite_Draw(const Sprite_t *sprite, int16_t x, int16_t y) {
+    numOpenRuns = 0;
+
+    for (uint8_t row = 0; row < sprite->h; row++) {
+        int16_t py = y + row;
+        if (py < 0) {
+            continue;
+        }
+        if (py >= Y_MAX) {
+            break;
+        }
+
+        const uint8_t *data = &sprite->data[sprite->rows[row]];
+        int16_t col = 0;
+
+        while (col < sprite->w) {
+            uint8_t count = data[0];
+            uint8_t index = data[1];
+            data += 2;
+
+            int16_t x0 = x + col;
+            int16_t x1 = x0 + count - 1;
+            col += count;
+
+            if (index == sprite->key) {
+                continue;
+            }
+
+            if (x0 < 0) {
+                x0 = 0;
+            }
+            if (x1 >= X_MAX) {
+                x1 = X_MAX - 1;
+            }
+            if (x0 <= x1) {
+                Sprite_AddRun(py, x0, x1, sprite->palette[index]);
+            }
+        }
+
+        Sprite_EndRow(py);
+    }
+
+    while (numOpenRuns > 0) {
+        Sprite_FlushRun(0);
+    }
+    ST7789_EndWindow();
+}
+
+// Sprite_ComposeRow
+// Decodes part of one row into a pixel buffer, leaving transparent
+// pixels as they were. Used to draw sprites into off-screen buffers.
+// Param Sprite_t* "sprite": sprite.
+// Param uint8_t "row": row of the sprite.
+// Param int16_t "x0", "x1": columns of the sprite to decode, end exclusive.
+// Param uint16_t* "out": pixel for column x0.
+// Return: void
+void Sprite_ComposeRow(const Sprite_t *sprite, uint8_t row, int16_t x0, int16_t x1, uint16_t *out) {
+    const uint8_t *data = &sprite->data[sprite->rows[row]];
+    int16_t col = 0;
+
+    while (col < x1) {
+        int16_t end = col + data[0];
+        uint8_t index = data[1];
+        data += 2;
+
+        if (end > x0 && index != sprite->key) {
+            uint16_t color = sprite->palette[index];
+            int16_t from = (col > x0) ? col : x0;
+            int16_t to = (end < x1) ? end : x1;
+            for (int16_t i = from; i < to; i++) {
+                out[i - x0] = color;
+            }
+        }
+        col = end;
+    }
+}
+
+/********************************Public Functions***********************************/
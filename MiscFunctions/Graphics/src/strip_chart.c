@@ -0,0 +1,87 @@
+// strip_chart.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Scrolling strip chart, one row of the display per sample
+
+/************************************Includes***************************************/
+
+#include "../inc/strip_chart.h"
+
+#include "../../../MultimodDrivers/multimod_ST7789.h"
+
+/************************************Includes***************************************/
+
+/*******************************Private Functions***********************************/
+
+// StripChart_Scale
+// Maps a value onto a column, clamped to the screen.
+// Param StripChart_t* "chart": chart.
+// Param int32_t "value": sample.
+// Return: int16_t
+static int16_t StripChart_Scale(const StripChart_t *chart, int32_t value) {
+    if (value <= chart->min) {
+        return 0;
+    }
+
+    if (value >= chart->max) {
+        return X_MAX - 1;
+    }
+
+    // A wide range overflows 32 bits once multiplied by the screen width
+    int64_t offset = (int64_t)value - chart->min;
+    int64_t range = (int64_t)chart->max - chart->min;
+    return (int16_t)((offset * (X_MAX - 1)) / range);
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// StripChart_Init
+// Sets up the rows of the chart as the scroll area and clears them.
+// The caller must hold the SPI bus for this and StripChart_Push.
+// Param StripChart_t* "chart": chart to set up.
+// Param uint16_t "top", "height": rows of the screen used by the chart.
+// Param int32_t "min", "max": values shown at the left and right edges.
+// Param uint16_t "color", "bg": trace and background colors.
+// Return: void
+void StripChart_Init(StripChart_t *chart, uint16_t top, uint16_t height, int32_t min, int32_t max,
+                     uint16_t color, uint16_t bg) {
+    chart->top = top;
+    chart->height = height;
+    chart->min = min;
+    chart->max = (max > min) ? max : min + 1;
+    chart->color = color;
+    chart->bg = bg;
+    chart->prevX = -1;
+
+    ST7789_DrawRectangle(0, top, X_MAX, height, bg);
+    ST7789_SetScrollArea(top, height);
+}
+
+// StripChart_Push
+// Scrolls the chart by one row and draws the new sample in it. Only
+// that row is sent, as one window holding a background run, the trace
+// from the previous sample and another background run.
+// Param StripChart_t* "chart": chart.
+// Param int32_t "value": new sample.
+// Return: void
+void StripChart_Push(StripChart_t *chart, int32_t value) {
+    int16_t x = StripChart_Scale(chart, value);
+    int16_t from = (chart->prevX < 0) ? x : chart->prevX;
+    int16_t lo = (from < x) ? from : x;
+    int16_t hi = (from < x) ? x : from;
+
+    ST7789_ScrollAdvance(1);
+    int16_t y = ST7789_ScrollRowY(chart->height - 1);
+
+    ST7789_BeginWindow(0, y, X_MAX, 1);
+    ST7789_WriteColor(chart->bg, lo);
+    ST7789_WriteColor(chart->color, hi - lo + 1);
+    ST7789_WriteColor(chart->bg, X_MAX - 1 - hi);
+    ST7789_EndWindow();
+
+    chart->prevX = x;
+}
+
+/********************************Public Functions***********************************/
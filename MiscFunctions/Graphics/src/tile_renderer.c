@@ -0,0 +1,625 @@
+// tile_renderer.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Retained display list rendered through dirty 16x16 tiles
+
+/************************************Includes***************************************/
+
+#include "../inc/tile_renderer.h"
+
+#include "../../../G8RTOS/G8RTOS_Semaphores.h"
+#include "../../../MultimodDrivers/GFX_Library.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+/*************************************Defines***************************************/
+
+/********************************Private Variables**********************************/
+
+static TileItem_t items[TILE_MAX_ITEMS];
+static uint32_t numItems = 0;
+static uint16_t backgroundColor;
+
+// One bit per tile, set when something under the tile changed
+static uint32_t dirty[(TILE_COUNT + 31) / 32];
+
+// Composed in one while the other is going out over uDMA
+static uint16_t tileBuffer[2][TILE_SIZE * TILE_SIZE];
+
+// Items whose bounds overlap each collision cell, visible or not
+static uint64_t grid[TILE_GRID_ROWS * TILE_GRID_COLS];
+
+static semaphore_t listLock;
+
+static uint32_t tilesSent = 0;
+static uint32_t bytesSent = 0;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// TileRenderer_Bounds
+// Gets the screen area covered by an item.
+// Param TileItem_t* "item": item.
+// Param int16_t* "x", "y", "w", "h": bounds, returned.
+// Return: void
+static void TileRenderer_Bounds(const TileItem_t *item, int16_t *x, int16_t *y, int16_t *w, int16_t *h) {
+    if (item->type == TILE_ITEM_TEXT) {
+        // Glyph row 0 sits on the cursor line, rows 1-7 go towards y = 0
+        int16_t len = 0;
+        while (item->text[len] != '\0') {
+            len++;
+        }
+        *x = item->x;
+        *y = item->y - 7 * item->size;
+        *w = len * 6 * item->size;
+        *h = 8 * item->size;
+    } else {
+        *x = item->x;
+        *y = item->y;
+        *w = item->w;
+        *h = item->h;
+    }
+}
+
+// TileRenderer_MarkDirty
+// Marks every tile under a rectangle dirty. Caller holds listLock.
+// Param int16_t "x", "y", "w", "h": rectangle.
+// Return: void
+static void TileRenderer_MarkDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    int32_t x1 = x + w - 1;
+    int32_t y1 = y + h - 1;
+
+    if (w <= 0 || h <= 0 || x1 < 0 || y1 < 0 || x >= X_MAX || y >= Y_MAX) {
+        return;
+    }
+
+    int32_t col0 = (x < 0) ? 0 : x / TILE_SIZE;
+    int32_t row0 = (y < 0) ? 0 : y / TILE_SIZE;
+    int32_t col1 = (x1 >= X_MAX) ? TILE_COLS - 1 : x1 / TILE_SIZE;
+    int32_t row1 = (y1 >= Y_MAX) ? TILE_ROWS - 1 : y1 / TILE_SIZE;
+
+    for (int32_t row = row0; row <= row1; row++) {
+        for (int32_t col = col0; col <= col1; col++) {
+            uint32_t tile = row * TILE_COLS + col;
+            dirty[tile >> 5] |= 1u << (tile & 31);
+        }
+    }
+}
+
+// TileRenderer_MarkItem
+// Marks the area of a visible item dirty. Caller holds listLock.
+// Param TileItem_t* "item": item.
+// Return: void
+static void TileRenderer_MarkItem(const TileItem_t *item) {
+    int16_t x, y, w, h;
+
+    if (!item->visible) {
+        return;
+    }
+
+    TileRenderer_Bounds(item, &x, &y, &w, &h);
+    TileRenderer_MarkDirty(x, y, w, h);
+}
+
+// TileRenderer_GridUpdate
+// Moves an item to the collision cells under its current bounds. Caller
+// holds listLock.
+// Param uint32_t "index": item index.
+// Return: void
+static void TileRenderer_GridUpdate(uint32_t index) {
+    uint64_t bit = (uint64_t)1 << index;
+    int16_t x, y, w, h;
+
+    for (uint32_t i = 0; i < TILE_GRID_ROWS * TILE_GRID_COLS; i++) {
+        grid[i] &= ~bit;
+    }
+
+    TileRenderer_Bounds(&items[index], &x, &y, &w, &h);
+    int32_t x1 = x + w - 1;
+    int32_t y1 = y + h - 1;
+
+    if (w <= 0 || h <= 0 || x1 < 0 || y1 < 0 || x >= X_MAX || y >= Y_MAX) {
+        return;
+    }
+
+    int32_t col0 = (x < 0) ? 0 : x / TILE_GRID_SIZE;
+    int32_t row0 = (y < 0) ? 0 : y / TILE_GRID_SIZE;
+    int32_t col1 = (x1 >= X_MAX) ? TILE_GRID_COLS - 1 : x1 / TILE_GRID_SIZE;
+    int32_t row1 = (y1 >= Y_MAX) ? TILE_GRID_ROWS - 1 : y1 / TILE_GRID_SIZE;
+
+    for (int32_t row = row0; row <= row1; row++) {
+        for (int32_t col = col0; col <= col1; col++) {
+            grid[row * TILE_GRID_COLS + col] |= bit;
+        }
+    }
+}
+
+// TileRenderer_QueryLocked
+// Finds the visible items overlapping a rectangle, topmost first.
+// Caller holds listLock.
+// Param int16_t "x", "y", "w", "h": rectangle.
+// Param int32_t "skip": item to leave out, -1 for none.
+// Param int32_t* "hits": item indices, returned.
+// Param uint32_t "maxHits": size of hits.
+// Return: uint32_t, number of items found.
+static uint32_t TileRenderer_QueryLocked(int16_t x, int16_t y, int16_t w, int16_t h, int32_t skip,
+                                         int32_t *hits, uint32_t maxHits) {
+    int32_t qx1 = x + w - 1;
+    int32_t qy1 = y + h - 1;
+    uint64_t candidates = 0;
+    uint32_t found = 0;
+
+    if (w <= 0 || h <= 0 || qx1 < 0 || qy1 < 0 || x >= X_MAX || y >= Y_MAX) {
+        return 0;
+    }
+
+    int32_t col0 = (x < 0) ? 0 : x / TILE_GRID_SIZE;
+    int32_t row0 = (y < 0) ? 0 : y / TILE_GRID_SIZE;
+    int32_t col1 = (qx1 >= X_MAX) ? TILE_GRID_COLS - 1 : qx1 / TILE_GRID_SIZE;
+    int32_t row1 = (qy1 >= Y_MAX) ? TILE_GRID_ROWS - 1 : qy1 / TILE_GRID_SIZE;
+
+    for (int32_t row = row0; row <= row1; row++) {
+        for (int32_t col = col0; col <= col1; col++) {
+            candidates |= grid[row * TILE_GRID_COLS + col];
+        }
+    }
+
+    // Later items are drawn on top, so walk the list backwards
+    for (int32_t i = numItems - 1; i >= 0 && found < maxHits; i--) {
+        if (!(candidates & ((uint64_t)1 << i)) || i == skip || !items[i].visible) {
+            continue;
+        }
+
+        int16_t ix, iy, iw, ih;
+        TileRenderer_Bounds(&items[i], &ix, &iy, &iw, &ih);
+        if (ix <= qx1 && iy <= qy1 && ix + iw > x && iy + ih > y) {
+            hits[found++] = i;
+        }
+    }
+
+    return found;
+}
+
+// TileRenderer_ComposeText
+// Draws the part of a text item inside a tile.
+// Param TileItem_t* "item": text item.
+// Param uint16_t* "buf": tile buffer.
+// Param int16_t "tx", "ty", "tw": tile origin and width.
+// Param int16_t "x0", "y0", "x1", "y1": part of the item inside the tile, end exclusive.
+// Return: void
+static void TileRenderer_ComposeText(const TileItem_t *item, uint16_t *buf, int16_t tx, int16_t ty, int16_t tw,
+                                     int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    int16_t s = item->size;
+    int16_t cell = 6 * s;
+    bool opaque = (item->color != item->bg);
+
+    for (int16_t py = y0; py < y1; py++) {
+        uint8_t row = (item->y + s - 1 - py) / s;
+        uint16_t *out = &buf[(py - ty) * tw + (x0 - tx)];
+
+        for (int16_t px = x0; px < x1; px++, out++) {
+            int16_t dx = px - item->x;
+            int16_t index = dx / cell;
+            uint8_t col = (dx - index * cell) / s;
+
+            if (col < 5 && ((display_getGlyph(item->text[index])[col] >> row) & 1)) {
+                *out = item->color;
+            } else if (opaque) {
+                *out = item->bg;
+            }
+        }
+    }
+}
+
+// TileRenderer_Compose
+// Renders the display list into one tile buffer. Caller holds listLock.
+// Param uint16_t* "buf": tile buffer.
+// Param int16_t "tx", "ty", "tw", "th": tile area, clipped to the screen.
+// Return: void
+static void TileRenderer_Compose(uint16_t *buf, int16_t tx, int16_t ty, int16_t tw, int16_t th) {
+    for (int32_t i = 0; i < tw * th; i++) {
+        buf[i] = backgroundColor;
+    }
+
+    for (uint32_t i = 0; i < numItems; i++) {
+        const TileItem_t *item = &items[i];
+        int16_t x, y, w, h;
+
+        if (!item->visible) {
+            continue;
+        }
+
+        TileRenderer_Bounds(item, &x, &y, &w, &h);
+
+        int16_t x0 = (x > tx) ? x : tx;
+        int16_t y0 = (y > ty) ? y : ty;
+        int16_t x1 = (x + w < tx + tw) ? x + w : tx + tw;
+        int16_t y1 = (y + h < ty + th) ? y + h : ty + th;
+
+        if (x0 >= x1 || y0 >= y1) {
+            continue;
+        }
+
+        if (item->type == TILE_ITEM_TEXT) {
+            TileRenderer_ComposeText(item, buf, tx, ty, tw, x0, y0, x1, y1);
+        } else if (item->type == TILE_ITEM_SPRITE) {
+            for (int16_t py = y0; py < y1; py++) {
+                Sprite_ComposeRow(item->sprite, py - y, x0 - x, x1 - x, &buf[(py - ty) * tw + (x0 - tx)]);
+            }
+        } else {
+            for (int16_t py = y0; py < y1; py++) {
+                uint16_t *out = &buf[(py - ty) * tw + (x0 - tx)];
+                for (int16_t px = x0; px < x1; px++) {
+                    *out++ = item->color;
+                }
+            }
+        }
+    }
+}
+
+// TileRenderer_Add
+// Appends an item to the display list.
+// Param TileItem_t* "item": item to copy.
+// Return: int32_t, item index or -1 if the list is full.
+static int32_t TileRenderer_Add(const TileItem_t *item) {
+    G8RTOS_WaitSemaphore(&listLock);
+
+    if (numItems >= TILE_MAX_ITEMS) {
+        G8RTOS_SignalSemaphore(&listLock);
+        return -1;
+    }
+
+    int32_t index = numItems++;
+    items[index] = *item;
+    TileRenderer_MarkItem(&items[index]);
+    TileRenderer_GridUpdate(index);
+
+    G8RTOS_SignalSemaphore(&listLock);
+    return index;
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TileRenderer_Init
+// Clears the display list. Call before G8RTOS_Launch.
+// Param uint16_t "color": color of screen not covered by any item.
+// Return: void
+void TileRenderer_Init(uint16_t color) {
+    numItems = 0;
+    backgroundColor = color;
+    tilesSent = 0;
+    bytesSent = 0;
+
+    for (uint32_t i = 0; i < sizeof(dirty) / sizeof(dirty[0]); i++) {
+        dirty[i] = 0;
+    }
+
+    for (uint32_t i = 0; i < TILE_GRID_ROWS * TILE_GRID_COLS; i++) {
+        grid[i] = 0;
+    }
+
+    G8RTOS_InitSemaphore(&listLock, 1);
+}
+
+// TileRenderer_AddRect
+// Adds a filled rectangle on top of the display list.
+// Param int16_t "x", "y", "w", "h": rectangle.
+// Param uint16_t "color": fill color.
+// Return: int32_t, item index or -1 if the list is full.
+int32_t TileRenderer_AddRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    TileItem_t item = {
+        .type = TILE_ITEM_RECT, .visible = 1, .x = x, .y = y, .w = w, .h = h, .color = color
+    };
+
+    return TileRenderer_Add(&item);
+}
+
+// TileRenderer_AddText
+// Adds a string on top of the display list. Text is transparent if color == bg.
+// Param int16_t "x", "y": cursor position, same as display_setCursor.
+// Param char* "str": string, cut to TILE_TEXT_MAX characters.
+// Param uint16_t "color", "bg": text and background colors.
+// Param uint8_t "size": text magnification.
+// Return: int32_t, item index or -1 if the list is full.
+int32_t TileRenderer_AddText(int16_t x, int16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t size) {
+    TileItem_t item = {
+        .type = TILE_ITEM_TEXT, .visible = 1, .x = x, .y = y,
+        .size = (size > 0) ? size : 1, .color = color, .bg = bg
+    };
+
+    uint32_t i;
+    for (i = 0; i < TILE_TEXT_MAX && str[i] != '\0'; i++) {
+        item.text[i] = str[i];
+    }
+    item.text[i] = '\0';
+
+    return TileRenderer_Add(&item);
+}
+
+// TileRenderer_AddSprite
+// Adds a sprite on top of the display list.
+// Param int16_t "x", "y": top left corner.
+// Param Sprite_t* "sprite": sprite, must stay valid while in the list.
+// Return: int32_t, item index or -1 if the list is full.
+int32_t TileRenderer_AddSprite(int16_t x, int16_t y, const Sprite_t *sprite) {
+    TileItem_t item = {
+        .type = TILE_ITEM_SPRITE, .visible = 1, .x = x, .y = y,
+        .w = sprite->w, .h = sprite->h, .sprite = sprite
+    };
+
+    return TileRenderer_Add(&item);
+}
+
+// TileRenderer_SetRect
+// Moves and resizes an item. Text and sprite items only use x and y.
+// Param int32_t "item": item index.
+// Param int16_t "x", "y", "w", "h": new rectangle.
+// Return: int32_t, 0 or -1 if the item does not exist.
+int32_t TileRenderer_SetRect(int32_t item, int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (item < 0 || (uint32_t)item >= numItems) {
+        return -1;
+    }
+
+    G8RTOS_WaitSemaphore(&listLock);
+
+    TileItem_t *entry = &items[item];
+    if (entry->type == TILE_ITEM_SPRITE) {
+        w = entry->w;
+        h = entry->h;
+    }
+
+    if (entry->x != x || entry->y != y || entry->w != w || entry->h != h) {
+        TileRenderer_MarkItem(entry);
+        entry->x = x;
+        entry->y = y;
+        entry->w = w;
+        entry->h = h;
+        TileRenderer_MarkItem(entry);
+        TileRenderer_GridUpdate(item);
+    }
+
+    G8RTOS_SignalSemaphore(&listLock);
+    return 0;
+}
+
+// TileRenderer_SetColor
+// Changes the color of an item.
+// Param int32_t "item": item index.
+// Param uint16_t "color": new color.
+// Return: int32_t, 0 or -1 if the item does not exist.
+int32_t TileRenderer_SetColor(int32_t item, uint16_t color) {
+    if (item < 0 || (uint32_t)item >= numItems) {
+        return -1;
+    }
+
+    G8RTOS_WaitSemaphore(&listLock);
+
+    TileItem_t *entry = &items[item];
+    if (entry->color != color) {
+        entry->color = color;
+        TileRenderer_MarkItem(entry);
+    }
+
+    G8RTOS_SignalSemaphore(&listLock);
+    return 0;
+}
+
+// TileRenderer_SetText
+// Changes the string of a text item. Only character cells that differ
+// from the current string are redrawn.
+// Param int32_t "item": item index.
+// Param char* "str": new string, cut to TILE_TEXT_MAX characters.
+// Return: int32_t, 0, -1 if the item does not exist or -2 if it is not text.
+int32_t TileRenderer_SetText(int32_t item, const char *str) {
+    if (item < 0 || (uint32_t)item >= numItems) {
+        return -1;
+    }
+
+    if (items[item].type != TILE_ITEM_TEXT) {
+        return -2;
+    }
+
+    G8RTOS_WaitSemaphore(&listLock);
+
+    TileItem_t *entry = &items[item];
+    int16_t cell = 6 * entry->size;
+    bool oldEnded = 0;
+    bool newEnded = 0;
+
+    // Only the character cells that changed are marked, so a counter
+    // going from 19 to 20 resends the tiles under two digits
+    for (uint32_t i = 0; i < TILE_TEXT_MAX; i++) {
+        oldEnded = oldEnded || (entry->text[i] == '\0');
+        newEnded = newEnded || (str[i] == '\0');
+
+        if (oldEnded && newEnded) {
+            entry->text[i] = '\0';
+            break;
+        }
+
+        char next = newEnded ? '\0' : str[i];
+        if (oldEnded || next != entry->text[i]) {
+            if (entry->visible) {
+                TileRenderer_MarkDirty(entry->x + i * cell, entry->y - 7 * entry->size, cell, 8 * entry->size);
+            }
+            entry->text[i] = next;
+        }
+    }
+    TileRenderer_GridUpdate(item);
+
+    G8RTOS_SignalSemaphore(&listLock);
+    return 0;
+}
+
+// TileRenderer_SetSprite
+// Swaps the image of a sprite item, e.g. for the next animation frame.
+// Param int32_t "item": item index.
+// Param Sprite_t* "sprite": new sprite.
+// Return: int32_t, 0, -1 if the item does not exist or -2 if it is not a sprite.
+int32_t TileRenderer_SetSprite(int32_t item, const Sprite_t *sprite) {
+    if (item < 0 || (uint32_t)item >= numItems) {
+        return -1;
+    }
+
+    if (items[item].type != TILE_ITEM_SPRITE) {
+        return -2;
+    }
+
+    G8RTOS_WaitSemaphore(&listLock);
+
+    TileItem_t *entry = &items[item];
+    if (entry->sprite != sprite) {
+        TileRenderer_MarkItem(entry);
+        entry->sprite = sprite;
+        entry->w = sprite->w;
+        entry->h = sprite->h;
+        TileRenderer_MarkItem(entry);
+        TileRenderer_GridUpdate(item);
+    }
+
+    G8RTOS_SignalSemaphore(&listLock);
+    return 0;
+}
+
+// TileRenderer_SetVisible
+// Shows or hides an item.
+// Param int32_t "item": item index.
+// Param bool "visible": true to draw the item.
+// Return: int32_t, 0 or -1 if the item does not exist.
+int32_t TileRenderer_SetVisible(int32_t item, bool visible) {
+    if (item < 0 || (uint32_t)item >= numItems) {
+        return -1;
+    }
+
+    G8RTOS_WaitSemaphore(&listLock);
+
+    TileItem_t *entry = &items[item];
+    if (entry->visible != visible) {
+        // Mark while visible so both showing and hiding repaint the area
+        entry->visible = 1;
+        TileRenderer_MarkItem(entry);
+        entry->visible = visible;
+    }
+
+    G8RTOS_SignalSemaphore(&listLock);
+    return 0;
+}
+
+// TileRenderer_Query
+// Finds the visible items whose bounds overlap a rectangle, using the
+// collision grid so only items in nearby cells are tested. Overlaps
+// entirely off the screen are not reported.
+// Param int16_t "x", "y", "w", "h": rectangle.
+// Param int32_t* "hits": item indices, topmost first, returned.
+// Param uint32_t "maxHits": size of hits.
+// Return: uint32_t, number of items found.
+uint32_t TileRenderer_Query(int16_t x, int16_t y, int16_t w, int16_t h, int32_t *hits, uint32_t maxHits) {
+    G8RTOS_WaitSemaphore(&listLock);
+    uint32_t found = TileRenderer_QueryLocked(x, y, w, h, -1, hits, maxHits);
+    G8RTOS_SignalSemaphore(&listLock);
+    return found;
+}
+
+// TileRenderer_Collide
+// Finds the visible items whose bounds overlap those of an item.
+// Param int32_t "item": item index.
+// Param int32_t* "hits": item indices, topmost first, returned.
+// Param uint32_t "maxHits": size of hits.
+// Return: uint32_t, number of items found, 0 if the item does not exist.
+uint32_t TileRenderer_Collide(int32_t item, int32_t *hits, uint32_t maxHits) {
+    if (item < 0 || (uint32_t)item >= numItems) {
+        return 0;
+    }
+
+    G8RTOS_WaitSemaphore(&listLock);
+
+    int16_t x, y, w, h;
+    TileRenderer_Bounds(&items[item], &x, &y, &w, &h);
+    uint32_t found = TileRenderer_QueryLocked(x, y, w, h, item, hits, maxHits);
+
+    G8RTOS_SignalSemaphore(&listLock);
+    return found;
+}
+
+// TileRenderer_Invalidate
+// Forces the tiles under a rectangle to be resent, e.g. after drawing
+// over them directly.
+// Param int16_t "x", "y", "w", "h": rectangle.
+// Return: void
+void TileRenderer_Invalidate(int16_t x, int16_t y, int16_t w, int16_t h) {
+    G8RTOS_WaitSemaphore(&listLock);
+    TileRenderer_MarkDirty(x, y, w, h);
+    G8RTOS_SignalSemaphore(&listLock);
+}
+
+// TileRenderer_InvalidateAll
+// Forces the whole screen to be resent on the next flush.
+// Return: void
+void TileRenderer_InvalidateAll(void) {
+    TileRenderer_Invalidate(0, 0, X_MAX, Y_MAX);
+}
+
+// TileRenderer_Flush
+// Composes and sends every dirty tile. Each tile is composed while the
+// previous one goes out over uDMA. Caller must hold the SPI bus.
+// Return: uint32_t, number of tiles sent.
+uint32_t TileRenderer_Flush(void) {
+    uint32_t sent = 0;
+    uint8_t current = 0;
+    ST7789Stats_t before, after;
+
+    G8RTOS_WaitSemaphore(&listLock);
+
+    // The caller holds the bus, so the driver counters only move for tiles
+    ST7789_GetStats(&before);
+
+    for (uint32_t tile = 0; tile < TILE_COUNT; tile++) {
+        if (!(dirty[tile >> 5] & (1u << (tile & 31)))) {
+            continue;
+        }
+        dirty[tile >> 5] &= ~(1u << (tile & 31));
+
+        int16_t tx = (tile % TILE_COLS) * TILE_SIZE;
+        int16_t ty = (tile / TILE_COLS) * TILE_SIZE;
+        int16_t tw = (tx + TILE_SIZE > X_MAX) ? X_MAX - tx : TILE_SIZE;
+        int16_t th = (ty + TILE_SIZE > Y_MAX) ? Y_MAX - ty : TILE_SIZE;
+
+        TileRenderer_Compose(tileBuffer[current], tx, ty, tw, th);
+
+        ST7789_DMA_Wait();
+        ST7789_DMA_BlitAsync(tx, ty, tw, th, tileBuffer[current]);
+        current ^= 1;
+
+        sent++;
+    }
+
+    ST7789_DMA_Wait();
+    tilesSent += sent;
+
+    ST7789_GetStats(&after);
+    bytesSent += (after.commandBytes + after.pixelBytes) - (before.commandBytes + before.pixelBytes);
+
+    G8RTOS_SignalSemaphore(&listLock);
+    return sent;
+}
+
+// TileRenderer_GetTilesSent
+// Gets the number of tiles sent since init.
+// Return: uint32_t
+uint32_t TileRenderer_GetTilesSent(void) {
+    return tilesSent;
+}
+
+// TileRenderer_GetBytesSent
+// Gets the number of bytes sent to the display since init, window
+// commands included, to compare against drawing directly.
+// Return: uint32_t
+uint32_t TileRenderer_GetBytesSent(void) {
+    return bytesSent;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,373 @@
+// widget.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Retained widget tree drawn through the tile renderer
+
+/************************************Includes***************************************/
+
+#include "../inc/widget.h"
+
+#include "../../../G8RTOS/G8RTOS_CriticalSection.h"
+
+/************************************Includes***************************************/
+
+/********************************Private Variables**********************************/
+
+static Widget_t widgets[WIDGET_MAX];
+static uint32_t numWidgets = 0;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// Widget_Valid
+// Checks a widget index.
+// Param int32_t "widget": widget index.
+// Return: bool
+static bool Widget_Valid(int32_t widget) {
+    return widget >= 0 && (uint32_t)widget < numWidgets;
+}
+
+// Widget_Shown
+// Checks whether a widget and all of its parents are visible.
+// Param int32_t "widget": widget index.
+// Return: bool
+static bool Widget_Shown(int32_t widget) {
+    while (widget != WIDGET_ROOT) {
+        if (!widgets[widget].visible) {
+            return 0;
+        }
+        widget = widgets[widget].parent;
+    }
+    return 1;
+}
+
+// Widget_FormatNumber
+// Writes prefix followed by a decimal number, cut to TILE_TEXT_MAX characters.
+// Param char* "buf": buffer of TILE_TEXT_MAX + 1 characters.
+// Param char* "prefix": text in front of the number.
+// Param int32_t "value": number to write.
+// Return: void
+static void Widget_FormatNumber(char *buf, const char *prefix, int32_t value) {
+    char digits[12];
+    uint32_t i = sizeof(digits) - 1;
+    uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+    digits[i] = '\0';
+    do {
+        digits[--i] = '0' + (magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+
+    if (value < 0) {
+        digits[--i] = '-';
+    }
+
+    uint32_t len = 0;
+    while (len < TILE_TEXT_MAX && *prefix != '\0') {
+        buf[len++] = *prefix++;
+    }
+    while (len < TILE_TEXT_MAX && digits[i] != '\0') {
+        buf[len++] = digits[i++];
+    }
+    buf[len] = '\0';
+}
+
+// Widget_Apply
+// Shows or hides the tile items of a widget and its children to match
+// the tree. The tile renderer only repaints items that actually change.
+// Param int32_t "widget": widget index.
+// Return: void
+static void Widget_Apply(int32_t widget) {
+    bool shown = Widget_Shown(widget);
+
+    for (uint8_t i = 0; i < widgets[widget].count; i++) {
+        TileRenderer_SetVisible(widgets[widget].items[i], shown);
+    }
+
+    // Children are always added after their parent
+    for (uint32_t child = widget + 1; child < numWidgets; child++) {
+        if (widgets[child].parent == widget) {
+            Widget_Apply(child);
+        }
+    }
+}
+
+// Widget_Add
+// Claims a widget slot.
+// Param int32_t "parent": parent widget or WIDGET_ROOT.
+// Param uint8_t "type": WidgetType_t.
+// Param int16_t "x", "y", "w", "h": area of the widget.
+// Return: int32_t, widget index or -1 if the pool is full or parent is invalid.
+static int32_t Widget_Add(int32_t parent, uint8_t type, int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (parent != WIDGET_ROOT && !Widget_Valid(parent)) {
+        return -1;
+    }
+
+    int32_t IBit_State = StartCriticalSection();
+    if (numWidgets >= WIDGET_MAX) {
+        EndCriticalSection(IBit_State);
+        return -1;
+    }
+    int32_t index = numWidgets;
+    widgets[index] = (Widget_t) {
+        .type = type, .visible = 1, .parent = parent, .count = 0,
+        .x = x, .y = y, .w = w, .h = h
+    };
+    numWidgets++;
+    EndCriticalSection(IBit_State);
+
+    return index;
+}
+
+// Widget_AddItem
+// Records a tile item as part of a widget.
+// Param int32_t "widget": widget index.
+// Param int32_t "item": tile item index, may be -1.
+// Return: int32_t, 0 or -1 if the tile renderer was full.
+static int32_t Widget_AddItem(int32_t widget, int32_t item) {
+    if (item < 0) {
+        return -1;
+    }
+
+    widgets[widget].items[widgets[widget].count++] = item;
+    return 0;
+}
+
+// Widget_Finish
+// Hides the new items if a parent is hidden.
+// Param int32_t "widget": widget index.
+// Param int32_t "error": result of adding the items.
+// Return: int32_t, widget index or -1 on error.
+static int32_t Widget_Finish(int32_t widget, int32_t error) {
+    if (error < 0) {
+        return -1;
+    }
+
+    if (!Widget_Shown(widget)) {
+        Widget_Apply(widget);
+    }
+    return widget;
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// Widget_Init
+// Clears the widget tree. Call after TileRenderer_Init.
+// Return: void
+void Widget_Init(void) {
+    numWidgets = 0;
+}
+
+// Widget_AddGroup
+// Adds an empty node used to show or hide its children together.
+// Param int32_t "parent": parent widget or WIDGET_ROOT.
+// Return: int32_t, widget index or -1 if full.
+int32_t Widget_AddGroup(int32_t parent) {
+    return Widget_Add(parent, WIDGET_GROUP, 0, 0, 0, 0);
+}
+
+// Widget_AddPanel
+// Adds a filled rectangle, e.g. a background for its children.
+// Param int32_t "parent": parent widget or WIDGET_ROOT.
+// Param int16_t "x", "y", "w", "h": rectangle.
+// Param uint16_t "color": fill color.
+// Return: int32_t, widget index or -1 if full.
+int32_t Widget_AddPanel(int32_t parent, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    int32_t widget = Widget_Add(parent, WIDGET_PANEL, x, y, w, h);
+    if (widget < 0) {
+        return -1;
+    }
+
+    return Widget_Finish(widget, Widget_AddItem(widget, TileRenderer_AddRect(x, y, w, h, color)));
+}
+
+// Widget_AddLabel
+// Adds a line of text. Text is transparent if color == bg.
+// Param int32_t "parent": parent widget or WIDGET_ROOT.
+// Param int16_t "x", "y": cursor position of the first character.
+// Param char* "text": initial text, copied.
+// Param uint16_t "color", "bg": text and background colors.
+// Param uint8_t "size": text magnification.
+// Return: int32_t, widget index or -1 if full.
+int32_t Widget_AddLabel(int32_t parent, int16_t x, int16_t y, const char *text, uint16_t color, uint16_t bg, uint8_t size) {
+    int32_t widget = Widget_Add(parent, WIDGET_LABEL, x, y, 0, 0);
+    if (widget < 0) {
+        return -1;
+    }
+
+    return Widget_Finish(widget, Widget_AddItem(widget, TileRenderer_AddText(x, y, text, color, bg, size)));
+}
+
+// Widget_AddNumber
+// Adds a prefix followed by a number set with Widget_SetValue.
+// Param int32_t "parent": parent widget or WIDGET_ROOT.
+// Param int16_t "x", "y": cursor position of the first character.
+// Param char* "prefix": text in front of the value, must stay valid.
+// Param uint16_t "color", "bg": text and background colors.
+// Param uint8_t "size": text magnification.
+// Return: int32_t, widget index or -1 if full.
+int32_t Widget_AddNumber(int32_t parent, int16_t x, int16_t y, const char *prefix, uint16_t color, uint16_t bg, uint8_t size) {
+    int32_t widget = Widget_Add(parent, WIDGET_NUMBER, x, y, 0, 0);
+    if (widget < 0) {
+        return -1;
+    }
+
+    widgets[widget].prefix = prefix;
+    return Widget_Finish(widget, Widget_AddItem(widget, TileRenderer_AddText(x, y, prefix, color, bg, size)));
+}
+
+// Widget_AddProgress
+// Adds a horizontal bar filled from the left in proportion to its value.
+// Param int32_t "parent": parent widget or WIDGET_ROOT.
+// Param int16_t "x", "y", "w", "h": bar.
+// Param uint16_t "color", "bg": filled and empty colors.
+// Param int32_t "max": value of a full bar.
+// Return: int32_t, widget index or -1 if full.
+int32_t Widget_AddProgress(int32_t parent, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t bg, int32_t max) {
+    int32_t widget = Widget_Add(parent, WIDGET_PROGRESS, x, y, w, h);
+    if (widget < 0) {
+        return -1;
+    }
+
+    widgets[widget].max = (max > 0) ? max : 1;
+    int32_t error = Widget_AddItem(widget, TileRenderer_AddRect(x, y, w, h, bg));
+    if (error == 0) {
+        error = Widget_AddItem(widget, TileRenderer_AddRect(x, y, 0, h, color));
+    }
+    return Widget_Finish(widget, error);
+}
+
+// Widget_AddList
+// Adds rows of text, e.g. a score table. Rows start empty.
+// Param int32_t "parent": parent widget or WIDGET_ROOT.
+// Param int16_t "x", "y": cursor position of the first row.
+// Param uint8_t "rows": number of rows, at most WIDGET_LIST_ROWS.
+// Param int16_t "spacing": y distance between rows, negative to go up.
+// Param uint16_t "color", "bg": text and background colors.
+// Param uint8_t "size": text magnification.
+// Return: int32_t, widget index or -1 if full.
+int32_t Widget_AddList(int32_t parent, int16_t x, int16_t y, uint8_t rows, int16_t spacing, uint16_t color, uint16_t bg, uint8_t size) {
+    int32_t widget = Widget_Add(parent, WIDGET_LIST, x, y, 0, spacing);
+    if (widget < 0) {
+        return -1;
+    }
+
+    if (rows > WIDGET_LIST_ROWS) {
+        rows = WIDGET_LIST_ROWS;
+    }
+
+    int32_t error = 0;
+    for (uint8_t i = 0; i < rows && error == 0; i++) {
+        error = Widget_AddItem(widget, TileRenderer_AddText(x, y + i * spacing, "", color, bg, size));
+    }
+    return Widget_Finish(widget, error);
+}
+
+// Widget_SetText
+// Changes the text of a label.
+// Param int32_t "widget": label widget.
+// Param char* "str": new text.
+// Return: int32_t, 0, -1 if the widget does not exist or -2 if it is not a label.
+int32_t Widget_SetText(int32_t widget, const char *str) {
+    if (!Widget_Valid(widget)) {
+        return -1;
+    }
+
+    if (widgets[widget].type != WIDGET_LABEL) {
+        return -2;
+    }
+
+    return TileRenderer_SetText(widgets[widget].items[0], str);
+}
+
+// Widget_SetValue
+// Changes the value of a number or progress bar. Only the digits or
+// the part of the bar that changed are repainted.
+// Param int32_t "widget": number or progress widget.
+// Param int32_t "value": new value, progress bars clamp it to 0..max.
+// Return: int32_t, 0, -1 if the widget does not exist or -2 if it has no value.
+int32_t Widget_SetValue(int32_t widget, int32_t value) {
+    if (!Widget_Valid(widget)) {
+        return -1;
+    }
+
+    Widget_t *entry = &widgets[widget];
+
+    if (entry->type == WIDGET_NUMBER) {
+        char text[TILE_TEXT_MAX + 1];
+        Widget_FormatNumber(text, entry->prefix, value);
+        return TileRenderer_SetText(entry->items[0], text);
+    }
+
+    if (entry->type == WIDGET_PROGRESS) {
+        if (value < 0) {
+            value = 0;
+        } else if (value > entry->max) {
+            value = entry->max;
+        }
+        int16_t fill = (int16_t)((value * entry->w) / entry->max);
+        return TileRenderer_SetRect(entry->items[1], entry->x, entry->y, fill, entry->h);
+    }
+
+    return -2;
+}
+
+// Widget_SetRowText
+// Changes one row of a list.
+// Param int32_t "widget": list widget.
+// Param uint8_t "row": row index.
+// Param char* "str": new text.
+// Return: int32_t, 0, -1 if the widget or row does not exist or -2 if it is not a list.
+int32_t Widget_SetRowText(int32_t widget, uint8_t row, const char *str) {
+    if (!Widget_Valid(widget) || row >= widgets[widget].count) {
+        return -1;
+    }
+
+    if (widgets[widget].type != WIDGET_LIST) {
+        return -2;
+    }
+
+    return TileRenderer_SetText(widgets[widget].items[row], str);
+}
+
+// Widget_SetRowNumber
+// Shows a number in one row of a list.
+// Param int32_t "widget": list widget.
+// Param uint8_t "row": row index.
+// Param int32_t "value": number to show.
+// Return: int32_t, 0, -1 if the widget or row does not exist or -2 if it is not a list.
+int32_t Widget_SetRowNumber(int32_t widget, uint8_t row, int32_t value) {
+    if (!Widget_Valid(widget) || row >= widgets[widget].count) {
+        return -1;
+    }
+
+    if (widgets[widget].type != WIDGET_LIST) {
+        return -2;
+    }
+
+    char text[TILE_TEXT_MAX + 1];
+    Widget_FormatNumber(text, "", value);
+    return TileRenderer_SetText(widgets[widget].items[row], text);
+}
+
+// Widget_SetVisible
+// Shows or hides a widget and everything under it.
+// Param int32_t "widget": widget index.
+// Param bool "visible": true to show.
+// Return: int32_t, 0 or -1 if the widget does not exist.
+int32_t Widget_SetVisible(int32_t widget, bool visible) {
+    if (!Widget_Valid(widget)) {
+        return -1;
+    }
+
+    if (widgets[widget].visible != visible) {
+        widgets[widget].visible = visible;
+        Widget_Apply(widget);
+    }
+    return 0;
+}
+
+/********************************Public Functions***********************************/
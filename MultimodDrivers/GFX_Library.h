@@ -26,6 +26,23 @@
 
 #define display_width   240
 #define display_height  310
+
+// Pre-expanded opaque glyphs kept in RAM for display_drawString, off by default
+// since the game's text is composed by the tile renderer. 3072 fits 10 cells.
+// Every slot holds one cell at GLYPH_CACHE_MAX_SIZE, larger text is not cached.
+#ifndef GLYPH_CACHE_BYTES
+#define GLYPH_CACHE_BYTES       0
+#endif
+#define GLYPH_CACHE_MAX_SIZE    2
+#define GLYPH_CACHE_CELL_PIXELS ((6 * GLYPH_CACHE_MAX_SIZE) * (8 * GLYPH_CACHE_MAX_SIZE))
+#define GLYPH_CACHE_SLOTS       (GLYPH_CACHE_BYTES / (2 * GLYPH_CACHE_CELL_PIXELS))
+
+// Fill circles, round rects and triangles as horizontal spans, rows with the
+// same span share one window. Set to 0 for the original line fills.
+#ifndef GFX_SPAN_FILL
+#define GFX_SPAN_FILL           1
+#endif
+
 #define display_drawPixel   ST7789_DrawPixel
 #define display_drawVLine   ST7789_DrawVLine
 #define display_drawHLine   ST7789_DrawHLine
@@ -51,8 +68,12 @@ void display_setTextColorBg(uint16_t c, uint16_t bg);
 void display_setTextSize(uint8_t s);
 void display_setTextWrap(bool w);
 void display_print(uint8_t c);
+void display_printString(const char *str);
+void display_drawString(int16_t x, int16_t y, const char *str, uint8_t len, uint16_t color, uint16_t bg, uint8_t size);
+void display_getGlyphCacheStats(uint32_t *hits, uint32_t *misses);
 void display_customChar(const uint8_t *c);
 void display_drawChar(uint16_t x, uint16_t y, uint8_t c, uint16_t color, uint16_t bg, uint8_t size);
+const uint8_t *display_getGlyph(uint8_t c);
 uint8_t  display_getRotation();
 uint16_t getCursorX(void);
 uint16_t getCursorY(void);
@@ -24,6 +24,10 @@
 #define ST7789_CS_PIN               GPIO_PIN_4
 #define ST7789_DC_PIN               GPIO_PIN_3
 
+// uDMA completion is signaled on the SSI0 vector
+#define ST7789_DMA_INTERRUPT        INT_SSI0
+#define ST7789_DMA_MAX_TRANSFER     1024
+
 // ST7789 Command Registers
 #define ST7789_NOP_ADDR             0x00
 #define ST7789_SWRESET_ADDR         0x01
@@ -79,8 +83,28 @@
 #define X_MAX                       240
 #define Y_MAX                       280
 
+// The panel shows frame memory rows 20-299 of 320
+#define ST7789_Y_OFFSET             20
+#define ST7789_MEMORY_ROWS          320
+
+// Interface pixel format. 12-bit (RGB444) sends two pixels in three
+// bytes, 25% less SPI traffic than RGB565 at the cost of color depth.
+#define ST7789_COLOR_16BIT          16
+#define ST7789_COLOR_12BIT          12
+#ifndef ST7789_COLOR_DEPTH
+#define ST7789_COLOR_DEPTH          ST7789_COLOR_16BIT
+#endif
+
+// Bytes of packed RGB444 pairs the uDMA repeats for 12-bit fills, the
+// largest multiple of three a single transfer can move
+#define ST7789_DMA_PATTERN_BYTES    1023
+
+// Bytes of packed RGB444 pairs the CPU paths build per burst
+#define ST7789_PACK_BYTES           96
+
 // COLORS
 #define ST7789_BLACK                0x0000
+#define ST7789_WHITE                0xFFFF
 #define ST7789_RED                  0x001F
 #define ST7789_BLUE                 0xF800
 #define ST7789_GREEN                0x07E0
@@ -94,6 +118,15 @@
 /*************************************Defines***************************************/
 
 /******************************Data Type Definitions********************************/
+
+// Transfer counters, see ST7789_GetStats
+typedef struct ST7789Stats_t {
+    uint32_t windows;           // CASET/RASET/RAMWR window setups
+    uint32_t commandBytes;      // command and parameter bytes
+    uint32_t pixelBytes;        // pixel data bytes
+    uint32_t busyCycles;        // CPU cycles with the display selected
+} ST7789Stats_t;
+
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
@@ -111,10 +144,40 @@ void ST7789_Init();
 void ST7789_WriteRegister(uint8_t addr, uint8_t data);
 uint8_t ST7789_ReadRegister(uint8_t addr);
 void ST7789_Fill(uint16_t color);
+void ST7789_SetColorDepth(uint8_t bits);
+uint8_t ST7789_GetColorDepth(void);
 void ST7789_DrawPixel(uint16_t x, uint16_t y, uint16_t color);
 void ST7789_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+void ST7789_DrawHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color);
+void ST7789_DrawVLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color);
 void ST7789_DrawRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
 
+void ST7789_BeginWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+void ST7789_WriteColor(uint16_t color, uint32_t count);
+void ST7789_WritePixels(const uint16_t *pixels, uint32_t count);
+void ST7789_EndWindow(void);
+
+void ST7789_SetScrollArea(uint16_t top, uint16_t height);
+void ST7789_ScrollAdvance(uint16_t rows);
+int16_t ST7789_ScrollRowY(uint16_t row);
+void ST7789_ScrollDisable(void);
+
+void ST7789_GetTransferStats(uint32_t *windows, uint32_t *bytes);
+void ST7789_GetStats(ST7789Stats_t *stats);
+void ST7789_ResetTransferStats(void);
+
+void ST7789_SetTearingEffect(bool enable);
+void ST7789_SetTearScanline(uint16_t line);
+
+void ST7789_DMA_Init(void);
+void ST7789_DMA_Handler(void);
+void ST7789_DMA_FillRectangleAsync(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void ST7789_DMA_BlitAsync(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+void ST7789_DMA_Wait(void);
+bool ST7789_DMA_Busy(void);
+void ST7789_DMA_FillRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void ST7789_DMA_Blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+
 /********************************Public Functions***********************************/
 
 /*******************************Private Variables***********************************/
@@ -49,6 +49,11 @@ void SPI_SetMode(uint32_t mod, uint8_t mode);
 uint8_t SPI_ReadSingle(uint32_t mod);
 void SPI_WriteMultiple(uint32_t mod, uint32_t* data, uint8_t num_bytes);
 void SPI_ReadMultiple(uint32_t mod, uint32_t* data, uint8_t num_bytes);
+void SPI_WriteBurst(uint32_t mod, const uint8_t* data, uint32_t num_bytes);
+void SPI_WriteRepeat16(uint32_t mod, uint16_t value, uint32_t count);
+void SPI_WriteBurst16(uint32_t mod, const uint16_t* data, uint32_t count);
+void SPI_WaitIdle(uint32_t mod);
+void SPI_SetDataWidth(uint32_t mod, uint8_t bits);
 
 /********************************Public Functions***********************************/
 
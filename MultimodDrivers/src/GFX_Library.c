@@ -69,6 +69,9 @@ void display_setTextColorBg(uint16_t c, uint16_t bg);
 void display_setTextSize(uint8_t s);
 void display_setTextWrap(bool w);
 void display_print(uint8_t c);
+void display_printString(const char *str);
+void display_drawString(int16_t x, int16_t y, const char *str, uint8_t len, uint16_t color, uint16_t bg, uint8_t size);
+void display_getGlyphCacheStats(uint32_t *hits, uint32_t *misses);
 void display_customChar(const uint8_t *c);
 void display_drawChar(uint16_t x, uint16_t y, uint8_t c, uint16_t color, uint16_t bg, uint8_t size);
 
@@ -107,6 +110,32 @@ uint8_t
 bool
   wrap = 1;           ///< If set, 'wrap' text at right edge of display
 
+static uint16_t glyphRow[X_MAX];  ///< One expanded row of text or bitmap
+
+static uint16_t spanColor;        ///< Color of the shape being filled
+#if GFX_SPAN_FILL
+static int16_t spanX0, spanX1;    ///< Columns of the pending span run
+static int16_t spanY, spanRows;   ///< First row and height of the pending span run
+static int16_t spanHalf[Y_MAX + 1];  ///< Half-width of a rounded shape per row from its corner center
+#endif
+
+#if GLYPH_CACHE_BYTES > 0
+/// One pre-expanded opaque character cell, rows in window order
+typedef struct {
+  uint16_t pixels[GLYPH_CACHE_CELL_PIXELS];
+  uint16_t color;
+  uint16_t bg;
+  uint8_t  c;
+  uint8_t  size;        ///< 0 if the slot is empty
+  uint32_t lastUsed;
+} glyphCacheSlot_t;
+
+static glyphCacheSlot_t glyphCache[GLYPH_CACHE_SLOTS];
+static uint32_t glyphClock = 0;
+#endif
+static uint32_t glyphCacheHits = 0;
+static uint32_t glyphCacheMisses = 0;
+
 // Standard ASCII 5x7 font
 #ifndef FONT5X7_H
 static const uint8_t font[256][5] = {
@@ -381,42 +410,8 @@ static const uint8_t font[256][5] = {
 */
 /**************************************************************************/
 void writeLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
-    bool steep = abs((int16_t)(y1 - y0)) > abs((int16_t)(x1 - x0));
-    if (steep) {
-        _swap_int16_t(x0, y0);
-        _swap_int16_t(x1, y1);
-    }
-
-    if (x0 > x1) {
-        _swap_int16_t(x0, x1);
-        _swap_int16_t(y0, y1);
-    }
-
-    int16_t dx, dy;
-    dx = x1 - x0;
-    dy = abs((int16_t)(y1 - y0));
-
-    int16_t err = dx / 2;
-    int16_t ystep;
-
-    if (y0 < y1) {
-        ystep = 1;
-    } else {
-        ystep = -1;
-    }
-
-    for (; x0<=x1; x0++) {
-        if (steep) {
-            display_drawPixel(y0, x0, color);
-        } else {
-            display_drawPixel(x0, y0, color);
-        }
-        err -= dy;
-        if (err < 0) {
-            y0 += ystep;
-            err += dx;
-        }
-    }
+    // The driver sends each straight run of the line as one window
+    ST7789_DrawLine(x0, y0, x1, y1, color);
 }
 
 /**************************************************************************/
@@ -442,35 +437,63 @@ void display_drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16
     }
 }
 
+/**************************************************************************/
+/*!
+   @brief    Fill the screen with a vertical gradient. Each channel steps by
+             diff / Y_MAX per row with the remainder carried in units of
+             1/Y_MAX, so row i gets exactly c1 + i * diff / Y_MAX without
+             dividing, and the whole screen streams through one window.
+    @param    r1, g1, b1   Color of the top row
+    @param    r2, g2, b2   Color the gradient runs towards
+*/
+/**************************************************************************/
 void display_fillGradient(uint8_t r1, uint8_t g1, uint8_t b1, uint8_t r2, uint8_t g2, uint8_t b2){
-    float rDiff = r2 - r1;
-    float gDiff = g2 - g1;
-    float bDiff = b2 - b1;
-    uint8_t rVal, bVal, gVal;
-    float rChange, gChange, bChange;
-
-    for (int i = Y_MAX; i >= 0; i--){
-        rChange = ((float)i)/(((float)Y_MAX)/rDiff);
-        gChange = ((float)i)/(((float)Y_MAX)/gDiff);
-        bChange = ((float)i)/(((float)Y_MAX)/bDiff);
-        ST7789_DrawHLine(0,i,X_MAX,display_color565(b1+(int)bChange, g1+(int)gChange,r1+(int)rChange));
+    int16_t diff[3] = {r2 - r1, g2 - g1, b2 - b1};
+    int16_t value[3] = {r1, g1, b1};
+    int16_t step[3], rem[3];
+    int16_t err[3] = {0, 0, 0};
+
+    for (uint8_t c = 0; c < 3; c++){
+        step[c] = diff[c] / Y_MAX;
+        rem[c] = diff[c] % Y_MAX;
     }
 
+    ST7789_BeginWindow(0, 0, X_MAX, Y_MAX);
+    for (int16_t i = 0; i < Y_MAX; i++){
+        ST7789_WriteColor(display_color565(value[2], value[1], value[0]), X_MAX);
+
+        for (uint8_t c = 0; c < 3; c++){
+            value[c] += step[c];
+            err[c] += rem[c];
+            if (err[c] >= Y_MAX){
+                value[c]++;
+                err[c] -= Y_MAX;
+            } else if (err[c] <= -Y_MAX){
+                value[c]--;
+                err[c] += Y_MAX;
+            }
+        }
+    }
+    ST7789_EndWindow();
 }
 
+/**************************************************************************/
+/*!
+   @brief    Fill the screen with the chroma color. Every row was the same
+             color, so this is one full-screen fill.
+    @param    r1, g1, b1   Base color
+    @param    r2, g2, b2   Unused
+*/
+/**************************************************************************/
 void display_fillChroma(uint8_t r1, uint8_t g1, uint8_t b1, uint8_t r2, uint8_t g2, uint8_t b2){
-        float rDiff = r2 - r1;
-        float gDiff = g2 - g1;
-        float bDiff = b2 - b1;
-        uint8_t rVal, bVal, gVal;
-        float rChange, gChange, bChange;
-
-        for (int i = Y_MAX; i >= 0; i--){
-            rChange = Y_MAX/40.0;
-            gChange = Y_MAX/40.0;
-            bChange = Y_MAX/40.0;
-            ST7789_DrawHLine(0,i,X_MAX,display_color565(b1+(int)bChange, g1+(int)gChange,r1+(int)rChange));
-        }
+    // End color kept for callers of the old per-row version
+    (void)r2;
+    (void)g2;
+    (void)b2;
+
+    // Each channel is offset by Y_MAX / 40
+    int16_t change = Y_MAX / 40;
+    ST7789_DrawRectangle(0, 0, X_MAX, Y_MAX, display_color565(b1 + change, g1 + change, r1 + change));
 }
 
 //
@@ -589,6 +612,138 @@ void display_drawCircleHelper(uint16_t x0, uint16_t y0, uint16_t r, uint8_t corn
     }
 }
 
+/**************************************************************************/
+/*!
+   @brief    Start filling a shape with spans
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+static void display_spanBegin(uint16_t color) {
+    spanColor = color;
+#if GFX_SPAN_FILL
+    spanRows = 0;
+#endif
+}
+
+#if GFX_SPAN_FILL
+/**************************************************************************/
+/*!
+   @brief    Send the pending run of identical spans as one window
+*/
+/**************************************************************************/
+static void display_spanFlush(void) {
+    if (spanRows) {
+        int16_t w = spanX1 - spanX0 + 1;
+        ST7789_BeginWindow(spanX0, spanY, w, spanRows);
+        ST7789_WriteColor(spanColor, (uint32_t)w * spanRows);
+        spanRows = 0;
+    }
+}
+#endif
+
+/**************************************************************************/
+/*!
+   @brief    Add one horizontal span, clipped to the screen. A span that
+             continues the pending run (next row, same columns) only
+             grows it, otherwise the run is flushed first. Chip select
+             stays low until display_spanEnd.
+    @param    y   Row
+    @param    x0  First column
+    @param    x1  Last column
+*/
+/**************************************************************************/
+static void display_span(int16_t y, int16_t x0, int16_t x1) {
+#if GFX_SPAN_FILL
+    if (y < 0 || y >= Y_MAX) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 >= X_MAX) x1 = X_MAX - 1;
+    if (x0 > x1) return;
+
+    if (spanRows && x0 == spanX0 && x1 == spanX1 && y == spanY + spanRows) {
+        spanRows++;
+        return;
+    }
+
+    display_spanFlush();
+    spanX0 = x0;
+    spanX1 = x1;
+    spanY = y;
+    spanRows = 1;
+#else
+    display_drawHLine(x0, y, x1 - x0 + 1, spanColor);
+#endif
+}
+
+/**************************************************************************/
+/*!
+   @brief    Finish a span fill
+*/
+/**************************************************************************/
+static void display_spanEnd(void) {
+#if GFX_SPAN_FILL
+    display_spanFlush();
+    ST7789_EndWindow();
+#endif
+}
+
+#if GFX_SPAN_FILL
+/**************************************************************************/
+/*!
+   @brief    Fill a rectangle with rounded corners as spans. Covers the same
+             pixels as the column fill of display_fillCircleHelper, whose
+             midpoint circle is symmetric about its diagonal, so column
+             heights double as row half-widths.
+    @param    cx0  Left corner-center x coordinate
+    @param    cx1  Right corner-center x coordinate
+    @param    cy0  Top corner-center y coordinate
+    @param    cy1  Bottom corner-center y coordinate, cy0 - 1 if none between
+    @param    r    Corner radius, at most Y_MAX
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+static void display_fillRoundSpans(int16_t cx0, int16_t cx1, int16_t cy0, int16_t cy1, int16_t r, uint16_t color) {
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+    int16_t px    = x;
+    int16_t py    = y;
+
+    spanHalf[0] = r;
+    for (int16_t i = 1; i <= r; i++) spanHalf[i] = 0;
+
+    while(x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f     += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f     += ddF_x;
+        if(x < (y + 1) && spanHalf[x] < y) spanHalf[x] = y;
+        if(y != py) {
+            if(spanHalf[py] < px) spanHalf[py] = px;
+            py = y;
+        }
+        px = x;
+    }
+
+    display_spanBegin(color);
+    for (int16_t dy = r; dy > 0; dy--) {
+        display_span(cy0 - dy, cx0 - spanHalf[dy], cx1 + spanHalf[dy]);
+    }
+    for (int16_t row = cy0; row <= cy1; row++) {
+        display_span(row, cx0 - r, cx1 + r);
+    }
+    for (int16_t dy = 1; dy <= r; dy++) {
+        display_span(cy1 + dy, cx0 - spanHalf[dy], cx1 + spanHalf[dy]);
+    }
+    display_spanEnd();
+}
+#endif
+
 /**************************************************************************/
 /*!
    @brief    Draw a circle with filled color
@@ -599,6 +754,12 @@ void display_drawCircleHelper(uint16_t x0, uint16_t y0, uint16_t r, uint8_t corn
 */
 /**************************************************************************/
 void display_fillCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color) {
+#if GFX_SPAN_FILL
+    if (r <= Y_MAX) {
+        display_fillRoundSpans(x0, x0, y0, y0, r, color);
+        return;
+    }
+#endif
     display_drawVLine(x0, y0-r, 2*r+1, color);
     display_fillCircleHelper(x0, y0, r, 3, 0, color);
 }
@@ -708,6 +869,12 @@ void display_fillRoundRect(uint16_t x, uint16_t y, uint16_t w,
   uint16_t h, uint16_t r, uint16_t color) {
     int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
     if(r > max_radius) r = max_radius;
+#if GFX_SPAN_FILL
+    if (r <= Y_MAX) {
+        display_fillRoundSpans(x+r, x+w-r-1, y+r, y+h-r-1, r, color);
+        return;
+    }
+#endif
     // smarter version
     display_fillRect(x+r, y, w-2*r, h, color);
     // draw four corners
@@ -768,7 +935,9 @@ void display_fillTriangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
         else if(x1 > b) b = x1;
         if(x2 < a)      a = x2;
         else if(x2 > b) b = x2;
-        display_drawHLine(a, y0, b-a+1, color);
+        display_spanBegin(color);
+        display_span(y0, a, b);
+        display_spanEnd();
         return;
     }
 
@@ -792,6 +961,8 @@ void display_fillTriangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
     if(y1 == y2) last = y1;   // Include y1 scanline
     else         last = y1-1; // Skip it
 
+    display_spanBegin(color);
+
     for(y=y0; y<=last; y++) {
         a   = x0 + sa / dy01;
         b   = x0 + sb / dy02;
@@ -802,7 +973,7 @@ void display_fillTriangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
         b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
         */
         if(a > b) _swap_int16_t(a,b);
-        display_drawHLine(a, y, b-a+1, color);
+        display_span(y, a, b);
     }
 
     // For lower part of triangle, find scanline crossings for segments
@@ -819,55 +990,185 @@ void display_fillTriangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
         b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
         */
         if(a > b) _swap_int16_t(a,b);
-        display_drawHLine(a, y, b-a+1, color);
+        display_span(y, a, b);
     }
+    display_spanEnd();
 }
 
+#if GLYPH_CACHE_BYTES > 0
 /**************************************************************************/
 /*!
-    @brief  Print one byte/character of data
-    @param  c  The 8-bit ascii character to write
+   @brief   Find or build the expanded cell of a character
+    @param    c   The 8-bit font-indexed character
+    @param    color 16-bit 5-6-5 text color
+    @param    bg 16-bit 5-6-5 background color
+    @param    size  Font magnification level, at most GLYPH_CACHE_MAX_SIZE
+    @param    pinned  Slots used after this clock value are not evicted
+    @returns  (6 * size) x (8 * size) pixels, or 0 if every slot is pinned
 */
 /**************************************************************************/
-void display_print(uint8_t c) {
+static const uint16_t *display_cachedGlyph(uint8_t c, uint16_t color, uint16_t bg, uint8_t size,
+     uint32_t pinned) {
+  glyphCacheSlot_t *empty = 0;
+  glyphCacheSlot_t *oldest = 0;
+
+  for(uint32_t i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+    glyphCacheSlot_t *slot = &glyphCache[i];
+    if(slot->size == 0) {
+      empty = slot;
+    } else if(slot->size == size && slot->c == c && slot->color == color && slot->bg == bg) {
+      slot->lastUsed = ++glyphClock;
+      glyphCacheHits++;
+      return slot->pixels;
+    } else if(slot->lastUsed <= pinned && (!oldest || slot->lastUsed < oldest->lastUsed)) {
+      oldest = slot;
+    }
+  }
 
-  if (c == ' ' && cursor_x == 0 && wrap)
-    return;
-  if(c == '\r') {
-    cursor_x = 0;
-    return;
+  // fill empty slots first, then evict the least recently used
+  glyphCacheSlot_t *victim = empty ? empty : oldest;
+  if(!victim) return 0;
+
+  glyphCacheMisses++;
+  victim->c = c;
+  victim->color = color;
+  victim->bg = bg;
+  victim->size = size;
+  victim->lastUsed = ++glyphClock;
+
+  uint16_t *out = victim->pixels;
+  for(int16_t r = 0; r < 8 * size; r++) {
+    uint8_t row = (8 * size - 1 - r) / size;
+    for(int16_t px = 0; px < 6 * size; px++) {
+      uint8_t col = px / size;
+      *out++ = (col < 5 && ((font[c][col] >> row) & 1)) ? color : bg;
+    }
   }
-  if(c == '\n') {
-    cursor_y += textsize * 8;
+
+  return victim->pixels;
+}
+#endif
+
+/**************************************************************************/
+/*!
+   @brief   Draw a run of characters on one line. Opaque text (color != bg)
+            is sent as a single window covering every character cell, one
+            glyph row at a time. Transparent text sends one rectangle per
+            vertical run of set pixels in each glyph column.
+    @param    x   Cursor x coordinate of the first character
+    @param    y   Cursor y coordinate, same as display_setCursor
+    @param    str Characters to draw, no control characters
+    @param    len Number of characters
+    @param    color 16-bit 5-6-5 Color to draw text with
+    @param    bg 16-bit 5-6-5 Color to fill background with (if same as color, no background)
+    @param    size  Font magnification level, 1 is 'original' size
+*/
+/**************************************************************************/
+void display_drawString(int16_t x, int16_t y, const char *str, uint8_t len, uint16_t color, uint16_t bg,
+     uint8_t size) {
+  if(size == 0) size = 1;
+  int16_t cell = size * 6;
+
+  if(color == bg) {
+    for(uint8_t n = 0; n < len; n++) {
+      const uint8_t *glyph = font[(uint8_t)str[n]];
+      for(uint8_t i = 0; i < 5; i++) {
+        uint8_t line = glyph[i];
+        uint8_t j = 0;
+        while(line) {
+          if(!(line & 1)) {
+            line >>= 1;
+            j++;
+            continue;
+          }
+          uint8_t run = 0;
+          while(line & 1) {
+            line >>= 1;
+            run++;
+          }
+          // row j is drawn at y - j * size, so the run grows towards y = 0
+          display_fillRect(x + n * cell + i * size, y - (j + run - 1) * size, size, run * size, color);
+          j += run;
+        }
+      }
+    }
     return;
   }
 
-  for(uint8_t i = 0; i < 5; i++ ) {
-    uint8_t line = font[c][i];
-    for(uint8_t j = 0; j < 8; j++, line >>= 1) {
-      if(line & 1) {
-        if(textsize == 1)
-          display_drawPixel(cursor_x + i, cursor_y - j, textcolor);
-        else
-          display_fillRect(cursor_x + i * textsize, cursor_y - j * textsize, textsize, textsize, textcolor);
-      } 
-      else 
-        if(textbgcolor != textcolor) {
-          if(textsize == 1)
-            display_drawPixel(cursor_x + i, cursor_y - j, textbgcolor);
-          else
-            display_fillRect(cursor_x + i * textsize, cursor_y + j - textsize, textsize, textsize, textbgcolor);
+  int32_t x0 = x, x1 = x + len * cell;
+  int32_t y0 = y - 7 * size, y1 = y + size;
+  if(x0 < 0) x0 = 0;
+  if(y0 < 0) y0 = 0;
+  if(x1 > X_MAX) x1 = X_MAX;
+  if(y1 > Y_MAX) y1 = Y_MAX;
+  if(x0 >= x1 || y0 >= y1) return;
+
+#if GLYPH_CACHE_BYTES > 0
+  if(size <= GLYPH_CACHE_MAX_SIZE && len <= GLYPH_CACHE_SLOTS) {
+    const uint16_t *cells[GLYPH_CACHE_SLOTS];
+    uint32_t pinned = glyphClock;
+    uint8_t n;
+
+    for(n = 0; n < len; n++) {
+      cells[n] = display_cachedGlyph(str[n], color, bg, size, pinned);
+      if(!cells[n]) break;
+    }
+
+    if(n == len) {
+      // every cell is ready, stream each row straight out of the cache
+      ST7789_BeginWindow(x0, y0, x1 - x0, y1 - y0);
+      for(int32_t py = y0; py < y1; py++) {
+        int32_t r = py - (y - 7 * size);
+        for(n = 0; n < len; n++) {
+          int32_t cx = x + n * cell;
+          int32_t a = (cx > x0) ? cx : x0;
+          int32_t b = (cx + cell < x1) ? cx + cell : x1;
+          if(a < b) ST7789_WritePixels(cells[n] + r * cell + (a - cx), b - a);
         }
+      }
+      ST7789_EndWindow();
+      return;
     }
   }
+#endif
 
-  if(textbgcolor != textcolor) {  // If opaque, draw vertical line for last column
-    if(textsize == 1)  display_drawVLine(cursor_x + 5, cursor_y, 8, textbgcolor);
-    else               display_fillRect(cursor_x + 5 * textsize, cursor_y, textsize, 8 * textsize, textbgcolor);
+  uint8_t prevRow = 0xFF;
+  ST7789_BeginWindow(x0, y0, x1 - x0, y1 - y0);
+  for(int32_t py = y0; py < y1; py++) {
+    // each glyph row repeats size times, only expand it once
+    uint8_t row = (y + size - 1 - py) / size;
+    if(row != prevRow) {
+      for(int32_t px = x0; px < x1; px++) {
+        int16_t dx = px - x;
+        uint8_t n = dx / cell;
+        uint8_t col = (dx - n * cell) / size;
+        glyphRow[px - x0] = (col < 5 && ((font[(uint8_t)str[n]][col] >> row) & 1)) ? color : bg;
+      }
+      prevRow = row;
+    }
+    ST7789_WritePixels(glyphRow, x1 - x0);
   }
+  ST7789_EndWindow();
+}
 
-  cursor_x += textsize * 6;
+/**************************************************************************/
+/*!
+    @brief  Get how often display_drawString found its glyphs in the cache
+    @param  hits    Number of cells reused, returned
+    @param  misses  Number of cells expanded into the cache, returned
+*/
+/**************************************************************************/
+void display_getGlyphCacheStats(uint32_t *hits, uint32_t *misses) {
+  *hits = glyphCacheHits;
+  *misses = glyphCacheMisses;
+}
 
+/**************************************************************************/
+/*!
+    @brief  Clamp the cursor and wrap to the next line after printing
+*/
+/**************************************************************************/
+static void display_wrapCursor(void) {
   if( cursor_x > ((uint16_t)display_width + textsize * 6) )
     cursor_x = display_width;
 
@@ -880,6 +1181,62 @@ void display_print(uint8_t c) {
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief  Print one byte/character of data
+    @param  c  The 8-bit ascii character to write
+*/
+/**************************************************************************/
+void display_print(uint8_t c) {
+
+  if (c == ' ' && cursor_x == 0 && wrap)
+    return;
+  if(c == '\r') {
+    cursor_x = 0;
+    return;
+  }
+  if(c == '\n') {
+    cursor_y += textsize * 8;
+    return;
+  }
+
+  display_drawString(cursor_x, cursor_y, (const char *)&c, 1, textcolor, textbgcolor, textsize);
+
+  cursor_x += textsize * 6;
+  display_wrapCursor();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Print a string. Characters up to the next newline or wrap
+            point are drawn together with display_drawString.
+    @param  str  Null terminated string to write
+*/
+/**************************************************************************/
+void display_printString(const char *str) {
+  while(*str) {
+    if(*str == '\n' || *str == '\r' || (*str == ' ' && cursor_x == 0 && wrap)) {
+      display_print(*str++);
+      continue;
+    }
+
+    uint8_t n = 0;
+    int16_t x = cursor_x;
+    while(str[n] != '\0' && str[n] != '\n' && str[n] != '\r' && n < 255) {
+      n++;
+      x += textsize * 6;
+      if (wrap && (x + (textsize * 5)) > display_width)
+        break;
+    }
+
+    display_drawString(cursor_x, cursor_y, str, n, textcolor, textbgcolor, textsize);
+    str += n;
+
+    cursor_x = x;
+    display_wrapCursor();
+  }
+}
+
 // print custom char (dimension: 7x5 or 8x5 pixel)
 void display_customChar(const uint8_t *c) {
 
@@ -952,6 +1309,17 @@ void display_drawChar(uint16_t x, uint16_t y, uint8_t c, uint16_t color, uint16_
   textsize    = prev_size;
 }
 
+/**************************************************************************/
+/*!
+   @brief   Get the 5 column bytes of a font glyph, bit j of each is row j
+    @param    c   The 8-bit font-indexed character (likely ascii)
+    @returns  Pointer to the glyph columns
+*/
+/**************************************************************************/
+const uint8_t *display_getGlyph(uint8_t c) {
+  return font[c];
+}
+
 /**************************************************************************/
 /*!
     @brief  Set text cursor location
@@ -1072,6 +1440,87 @@ uint16_t display_color565(uint8_t red, uint8_t green, uint8_t blue) {
     return ((uint16_t)(red & 0xF8) << 8) | ((uint16_t)(green & 0xFC) << 3) | (blue >> 3);
 }
 
+/**************************************************************************/
+/*!
+   @brief     Read one pixel of a 1-bit image
+    @param    bitmap  byte array with monochrome bitmap
+    @param    paged   true for V1 layout (bytes are 8-row columns),
+                      false for V2 layout (MSB-first rows padded to bytes)
+    @param    w   Width of bitmap in pixels
+    @param    col Column of the pixel
+    @param    row Row of the pixel
+    @returns  true if the bit is set
+*/
+/**************************************************************************/
+static inline bool display_bitmapBit(const uint8_t *bitmap, bool paged, uint16_t w, uint16_t col, uint16_t row) {
+  if(paged)
+    return bitmap[(row >> 3) * w + col] & (1 << (row & 7));
+  return bitmap[row * ((w + 7) >> 3) + (col >> 3)] & (0x80 >> (col & 7));
+}
+
+/**************************************************************************/
+/*!
+   @brief     Draw an opaque 1-bit image through one window, expanding each
+              row into glyphRow. Parts past the right and bottom edges are
+              clipped.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap
+    @param    paged   true for V1 layout, false for V2 layout
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color 16-bit 5-6-5 Color to draw set bits with
+    @param    bg 16-bit 5-6-5 Color to draw unset bits with
+*/
+/**************************************************************************/
+static void display_bitmapOpaque(uint16_t x, uint16_t y, const uint8_t *bitmap, bool paged,
+     uint16_t w, uint16_t h, uint16_t color, uint16_t bg) {
+  if(x >= X_MAX || y >= Y_MAX || w == 0 || h == 0) return;
+  uint16_t cw = (x + w > X_MAX) ? X_MAX - x : w;
+  uint16_t ch = (y + h > Y_MAX) ? Y_MAX - y : h;
+
+  ST7789_BeginWindow(x, y, cw, ch);
+  for(uint16_t row = 0; row < ch; row++) {
+    for(uint16_t col = 0; col < cw; col++)
+      glyphRow[col] = display_bitmapBit(bitmap, paged, w, col, row) ? color : bg;
+    ST7789_WritePixels(glyphRow, cw);
+  }
+  ST7789_EndWindow();
+}
+
+/**************************************************************************/
+/*!
+   @brief     Draw the set bits of a 1-bit image as horizontal runs, one
+              window per run (or per block of identical runs) instead of
+              one per pixel.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap
+    @param    paged   true for V1 layout, false for V2 layout
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color 16-bit 5-6-5 Color to draw set bits with
+*/
+/**************************************************************************/
+static void display_bitmapRuns(uint16_t x, uint16_t y, const uint8_t *bitmap, bool paged,
+     uint16_t w, uint16_t h, uint16_t color) {
+  if(x >= X_MAX || y >= Y_MAX) return;
+  if(y + h > Y_MAX) h = Y_MAX - y;
+  uint16_t cw = (x + w > X_MAX) ? X_MAX - x : w;
+
+  display_spanBegin(color);
+  for(uint16_t row = 0; row < h; row++) {
+    uint16_t col = 0;
+    while(col < cw) {
+      while(col < cw && !display_bitmapBit(bitmap, paged, w, col, row)) col++;
+      uint16_t start = col;
+      while(col < cw && display_bitmapBit(bitmap, paged, w, col, row)) col++;
+      if(col > start) display_span(y + row, x + start, x + col - 1);
+    }
+  }
+  display_spanEnd();
+}
+
 /**************************************************************************/
 /*!
    @brief     Draw a const-resident 1-bit image at the specified (x,y) position,
@@ -1086,14 +1535,8 @@ uint16_t display_color565(uint8_t red, uint8_t green, uint8_t blue) {
 /**************************************************************************/
 void display_drawBitmapV1(uint16_t x, uint16_t y, const uint8_t *bitmap, uint16_t w, uint16_t h,
      uint16_t color) {
-  for( uint16_t i = 0; i < h/8; i++)
-  {    
-    for( uint16_t j = 0; j < w * 8; j++)
-    {      
-      if( bitmap[j/8 + i*w] & (1 << (j % 8)) )
-        display_drawPixel(x + j/8, y + i*8 + (j % 8), color);
-    }
-  }
+  // Only whole 8-row pages are drawn
+  display_bitmapRuns(x, y, bitmap, 1, w, h & ~7, color);
 }
 
 /**************************************************************************/
@@ -1111,16 +1554,8 @@ void display_drawBitmapV1(uint16_t x, uint16_t y, const uint8_t *bitmap, uint16_
 /**************************************************************************/
 void display_drawBitmapV1_bg(uint16_t x, uint16_t y, const uint8_t *bitmap, uint16_t w, uint16_t h,
      uint16_t color, uint16_t bg) {
-  for( uint16_t i = 0; i < h/8; i++)
-  {    
-    for( uint16_t j = 0; j < w * 8; j++)
-    {      
-      if( bitmap[j/8 + i*w] & (1 << (j % 8)) )
-        display_drawPixel(x + j/8, y + i*8 + (j % 8), color);
-      else
-        display_drawPixel(x + j/8, y + i*8 + (j % 8), bg);
-    }
-  }
+  // Only whole 8-row pages are drawn
+  display_bitmapOpaque(x, y, bitmap, 1, w, h & ~7, color, bg);
 }
 
 /**************************************************************************/
@@ -1137,18 +1572,7 @@ void display_drawBitmapV1_bg(uint16_t x, uint16_t y, const uint8_t *bitmap, uint
 /**************************************************************************/
 void display_drawBitmapV2(uint16_t x, uint16_t y, const uint8_t *bitmap, uint16_t w, uint16_t h,
   uint16_t color) {
-
-    int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
-    uint8_t _byte = 0;
-
-    for(int16_t j=0; j<h; j++, y++) {
-        for(int16_t i=0; i<w; i++ ) {
-            if(i & 7) _byte <<= 1;
-            else      _byte   = bitmap[j * byteWidth + i / 8];
-            if(_byte & 0x80)
-              display_drawPixel(x+i, y, color);
-        }
-    }
+    display_bitmapRuns(x, y, bitmap, 0, w, h, color);
 }
 
 /**************************************************************************/
@@ -1166,20 +1590,7 @@ void display_drawBitmapV2(uint16_t x, uint16_t y, const uint8_t *bitmap, uint16_
 /**************************************************************************/
 void display_drawBitmapV2_bg(uint16_t x, uint16_t y, const uint8_t *bitmap, uint16_t w, uint16_t h,
   uint16_t color, uint16_t bg) {
-
-    int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
-    uint8_t _byte = 0;
-
-    for(int16_t j=0; j<h; j++, y++) {
-        for(int16_t i=0; i<w; i++ ) {
-            if(i & 7) _byte <<= 1;
-            else      _byte   = bitmap[j * byteWidth + i / 8];
-            if(_byte & 0x80)
-              display_drawPixel(x+i, y, color);
-            else
-              display_drawPixel(x+i, y, bg);
-        }
-    }
+    display_bitmapOpaque(x, y, bitmap, 0, w, h, color, bg);
 }
 
 // end of code.
@@ -8,6 +8,9 @@
 #include "../multimod_ST7789.h"
 
 #include "../multimod_spi.h"
+#include "../../G8RTOS/G8RTOS_Semaphores.h"
+
+#include <stdlib.h>
 
 #include <inc/tm4c123gh6pm.h>
 #include <inc/hw_types.h>
@@ -19,6 +22,7 @@
 #include <driverlib/sysctl.h>
 #include <driverlib/uart.h>
 #include <driverlib/pin_map.h>
+#include <driverlib/udma.h>
 
 /************************************Includes***************************************/
 
@@ -31,22 +35,133 @@
     b = t; \
 }
 #endif
+
+// Bus time is measured in CPU cycles, on the board with the Cortex-M4 DWT
+// cycle counter, on the host with the model's count of clocked bits
+#ifdef ST7789_HOST
+uint32_t Host_Cycles(void);
+#define ST7789_CYCLES()             Host_Cycles()
+#else
+#define ST7789_DEMCR                0xE000EDFC
+#define ST7789_DEMCR_TRCENA         0x01000000
+#define ST7789_DWT_CTRL             0xE0001000
+#define ST7789_DWT_CYCCNTENA        0x00000001
+#define ST7789_DWT_CYCCNT           0xE0001004
+#define ST7789_CYCLES()             HWREG(ST7789_DWT_CYCCNT)
+#endif
 /***********************************Macro Defines***********************************/
 
+/********************************Private Variables**********************************/
+
+// uDMA channel control table, must be 1024-byte aligned
+#if defined(ccs)
+#pragma DATA_ALIGN(DMAControlTable, 1024)
+static uint8_t DMAControlTable[1024];
+#else
+static uint8_t DMAControlTable[1024] __attribute__ ((aligned(1024)));
+#endif
+
+// State of the transfer in progress, shared with ST7789_DMA_Handler
+static uint16_t dmaColor;
+static const uint16_t *dmaSource;
+static uint32_t dmaRemaining;
+static bool dmaIncrement;
+static bool dmaRewind;
+static volatile bool dmaActive;
+static semaphore_t dmaDone;
+
+// Set while SSI0 is in 16-bit frames for RAMWR pixel data
+static bool pixelMode = 0;
+
+// Interface pixel format, ST7789_COLOR_16BIT or ST7789_COLOR_12BIT
+static uint8_t colorBits = ST7789_COLOR_DEPTH;
+
+// RGB444 pixels packed two per three bytes. packBuffer is reused by the
+// CPU paths, dmaPattern holds one repeated color for 12-bit uDMA fills.
+static uint8_t packBuffer[ST7789_PACK_BYTES];
+static uint8_t dmaPattern[ST7789_DMA_PATTERN_BYTES];
+
+// RGB444 pixel waiting for a partner. A window can be filled by several
+// pushes, an odd one leaves its last pixel here so the next push starts
+// on a pair boundary. ST7789_FlushPending sends it on its own.
+static uint16_t pendingPixel;
+static bool hasPending = 0;
+
+// Windows opened, bytes sent and cycles spent with the display selected,
+// for comparing draw paths
+static uint32_t statWindows = 0;
+static uint32_t statCommandBytes = 0;
+static uint32_t statPixelBytes = 0;
+static uint32_t statBusyCycles = 0;
+static uint32_t busyStart = 0;
+static bool busy = 0;
+
+// Vertical scroll area, in drawing coordinates, and its current start
+static uint16_t scrollTop = 0;
+static uint16_t scrollHeight = 0;
+static uint16_t scrollOffset = 0;
+
+/********************************Private Variables**********************************/
+
 /********************************Private Functions**********************************/
 
 // ST7789_Select
 // Selects the ST7789 for SPI transmission.
 // Return: void
 void ST7789_Select(void) {
+    if (!busy) {
+        busy = 1;
+        busyStart = ST7789_CYCLES();
+    }
     GPIOPinWrite(ST7789_PIN_PORT_BASE, ST7789_CS_PIN, 0x00);
 }
 
+// ST7789_To444
+// Converts an RGB565 color to RGB444 by keeping the top bits of each field.
+// Param uint16_t "color": RGB565 color.
+// Return: uint16_t
+static inline uint16_t ST7789_To444(uint16_t color) {
+    return (((color >> 12) & 0xF) << 8) | (((color >> 7) & 0xF) << 4) | ((color >> 1) & 0xF);
+}
+
+// ST7789_PackPair
+// Packs two RGB444 pixels into three bytes.
+// Param uint16_t "a", "b": RGB444 pixels, a is sent first.
+// Param uint8_t* "out": three bytes.
+// Return: void
+static inline void ST7789_PackPair(uint16_t a, uint16_t b, uint8_t *out) {
+    out[0] = (a >> 4) & 0xFF;
+    out[1] = ((a & 0xF) << 4) | ((b >> 8) & 0xF);
+    out[2] = b & 0xFF;
+}
+
+// ST7789_FlushPending
+// Sends the RGB444 pixel left over by an odd push. Two bytes complete it,
+// the low nibble of the second byte is ignored.
+// Return: void
+static void ST7789_FlushPending(void) {
+    if (!hasPending) {
+        return;
+    }
+
+    uint8_t bytes[3];
+    ST7789_PackPair(pendingPixel, 0, bytes);
+    statPixelBytes += 2;
+    SPI_WriteBurst(SPI_A_BASE, bytes, 2);
+    hasPending = 0;
+}
+
 // ST7789_Deselect
-// Deselects the ST7789 for SPI transmission.
+// Deselects the ST7789 for SPI transmission, finishing any RGB444 pixel
+// still waiting for a partner.
 // Return: void
 void ST7789_Deselect(void) {
+    ST7789_FlushPending();
     GPIOPinWrite(ST7789_PIN_PORT_BASE, ST7789_CS_PIN, 0xFF);
+    if (busy) {
+        statBusyCycles += ST7789_CYCLES() - busyStart;
+        busy = 0;
+    }
 }
 
 // ST7789_SetData
@@ -69,6 +184,16 @@ void ST7789_SetCommand(void) {
 // Param uint8_t "cmd": command register to send data to.
 // Return: void
 void ST7789_WriteCommand(uint8_t cmd) {
+    // A new command ends the window the pending pixel belongs to
+    ST7789_FlushPending();
+
+    // Commands and their parameters are 8-bit frames
+    if (pixelMode) {
+        SPI_SetDataWidth(SPI_A_BASE, 8);
+        pixelMode = 0;
+    }
+
+    statCommandBytes++;
     ST7789_SetCommand();
     SPI_WriteSingle(SPI_A_BASE, cmd);
     ST7789_SetData();
@@ -79,9 +204,20 @@ void ST7789_WriteCommand(uint8_t cmd) {
 // Param uint8_t "data": data to be sent.
 // Return: void
 void ST7789_WriteData(uint8_t data) {
+    statCommandBytes++;
     SPI_WriteSingle(SPI_A_BASE, data);
 }
 
+// ST7789_WriteParams
+// Sends the parameters of a command in one burst.
+// Param uint8_t* "params": parameter bytes.
+// Param uint32_t "count": number of bytes.
+// Return: void
+static void ST7789_WriteParams(const uint8_t *params, uint32_t count) {
+    statCommandBytes += count;
+    SPI_WriteBurst(SPI_A_BASE, params, count);
+}
+
 // ST7789_ReadRegister
 // Reads from SPI bus.
 // Return: uint8_t
@@ -90,7 +226,8 @@ uint8_t ST7789_ReadRegister(uint8_t data) {
 }
 
 // ST7789_SetWindow
-// Sets windows subsequent pixels will be generated at.
+// Sets windows subsequent pixels will be generated at, and
+// leaves SSI0 in 16-bit frames ready for pixel data.
 // Param int16_t x: x-coord of first corner.
 // Param int16_t y: y-coord of first corner.
 // Param int16_t w: width of window.
@@ -105,22 +242,134 @@ void ST7789_SetWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
         y = 0;
     }
 
-    // offset y by 20
-    y += 20;
+    // offset y to the first visible memory row
+    y += ST7789_Y_OFFSET;
+
+    uint8_t caset[4] = {
+        (x >> 8) & 0xFF, (x >> 0) & 0xFF,
+        ((x + w - 1) >> 8) & 0xFF, ((x + w - 1) >> 0) & 0xFF
+    };
+    uint8_t raset[4] = {
+        (y >> 8) & 0xFF, (y >> 0) & 0xFF,
+        ((y + h - 1) >> 8) & 0xFF, ((y + h - 1) >> 0) & 0xFF
+    };
 
     ST7789_WriteCommand(ST7789_CASET_ADDR);
-    ST7789_WriteData((x >> 8) & 0xFF);
-    ST7789_WriteData((x >> 0) & 0xFF);
-    ST7789_WriteData(((x + w - 1) >> 8) & 0xFF);
-    ST7789_WriteData(((x + w - 1) >> 0) & 0xFF);
+    ST7789_WriteParams(caset, 4);
 
     ST7789_WriteCommand(ST7789_RASET_ADDR);
-    ST7789_WriteData((y >> 8) & 0xFF);
-    ST7789_WriteData((y >> 0) & 0xFF);
-    ST7789_WriteData(((y + h - 1) >> 8) & 0xFF);
-    ST7789_WriteData(((y + h - 1) >> 0) & 0xFF);
+    ST7789_WriteParams(raset, 4);
 
     ST7789_WriteCommand(ST7789_RAMWR_ADDR);
+
+    statWindows++;
+
+    // RGB565 pixels go out one per 16-bit frame until the next command,
+    // packed RGB444 stays in 8-bit frames
+    if (colorBits == ST7789_COLOR_16BIT) {
+        SPI_SetDataWidth(SPI_A_BASE, 16);
+        pixelMode = 1;
+    }
+}
+
+// ST7789_PackColor
+// Fills a buffer with one color as packed RGB444 pairs.
+// Param uint8_t* "buffer": buffer to fill.
+// Param uint32_t "bytes": buffer length, a multiple of three.
+// Param uint16_t "color": RGB565 color.
+// Return: void
+static void ST7789_PackColor(uint8_t *buffer, uint32_t bytes, uint16_t color) {
+    uint16_t c = ST7789_To444(color);
+    for (uint32_t i = 0; i < bytes; i += 3) {
+        ST7789_PackPair(c, c, &buffer[i]);
+    }
+}
+
+// ST7789_PushColor
+// Sends count pixels of one color into the open window in the current
+// interface format.
+// Param uint16_t "color": RGB565 color.
+// Param uint32_t "count": number of pixels.
+// Return: void
+static void ST7789_PushColor(uint16_t color, uint32_t count) {
+    if (colorBits == ST7789_COLOR_16BIT) {
+        statPixelBytes += 2 * count;
+        SPI_WriteRepeat16(SPI_A_BASE, color, count);
+        return;
+    }
+
+    uint16_t c = ST7789_To444(color);
+
+    // Pair up the pixel left by the previous push first
+    if (hasPending && count) {
+        uint8_t bytes[3];
+        ST7789_PackPair(pendingPixel, c, bytes);
+        statPixelBytes += 3;
+        SPI_WriteBurst(SPI_A_BASE, bytes, 3);
+        hasPending = 0;
+        count--;
+    }
+
+    ST7789_PackColor(packBuffer, ST7789_PACK_BYTES, color);
+
+    uint32_t bytes = (count / 2) * 3;
+    statPixelBytes += bytes;
+    while (bytes > 0) {
+        uint32_t n = (bytes > ST7789_PACK_BYTES) ? ST7789_PACK_BYTES : bytes;
+        SPI_WriteBurst(SPI_A_BASE, packBuffer, n);
+        bytes -= n;
+    }
+
+    if (count & 1) {
+        pendingPixel = c;
+        hasPending = 1;
+    }
+}
+
+// ST7789_PushPixels
+// Sends count RGB565 pixels into the open window in the current
+// interface format.
+// Param uint16_t* "pixels": pixel data.
+// Param uint32_t "count": number of pixels.
+// Return: void
+static void ST7789_PushPixels(const uint16_t *pixels, uint32_t count) {
+    if (colorBits == ST7789_COLOR_16BIT) {
+        statPixelBytes += 2 * count;
+        SPI_WriteBurst16(SPI_A_BASE, pixels, count);
+        return;
+    }
+
+    uint32_t n = 0;
+    if (hasPending && count) {
+        ST7789_PackPair(pendingPixel, ST7789_To444(pixels[0]), packBuffer);
+        hasPending = 0;
+        pixels++;
+        count--;
+        n = 3;
+    }
+
+    while (count >= 2) {
+        ST7789_PackPair(ST7789_To444(pixels[0]), ST7789_To444(pixels[1]), &packBuffer[n]);
+        pixels += 2;
+        count -= 2;
+        n += 3;
+
+        if (n == ST7789_PACK_BYTES) {
+            statPixelBytes += n;
+            SPI_WriteBurst(SPI_A_BASE, packBuffer, n);
+            n = 0;
+        }
+    }
+
+    if (n) {
+        statPixelBytes += n;
+        SPI_WriteBurst(SPI_A_BASE, packBuffer, n);
+    }
+
+    if (count) {
+        pendingPixel = ST7789_To444(pixels[0]);
+        hasPending = 1;
+    }
 }
 
 // ST7789_DrawVLine
@@ -134,17 +383,11 @@ void ST7789_DrawVLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color)
 {
     if ((x < X_MAX) && (y < Y_MAX) && h)
     {
-        uint8_t color_hi = color >> 8, color_lo = color;
         if ((y + h - 1) >= Y_MAX)
             h = Y_MAX - y;
         ST7789_Select();
         ST7789_SetWindow(x, y, 1, h);
-        while (h--)
-        {
-            ST7789_WriteData(color_hi);
-            ST7789_WriteData(color_lo);
-        }
-
+        ST7789_PushColor(color, h);
         ST7789_Deselect();
     }
 }
@@ -159,26 +402,49 @@ void ST7789_DrawVLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color)
 void ST7789_DrawHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color) {
     if ((x < X_MAX) && (y < Y_MAX) && w)
     {
-        uint8_t color_hi = color >> 8, color_lo = color;
-
-        if ((x >= X_MAX) || (y >= Y_MAX))
-            return;
         if ((x + w - 1) >= X_MAX)
             w = X_MAX - x;
         ST7789_Select();
         ST7789_SetWindow(x, y, w, 1);
-        while (w--)
-        {
-            ST7789_WriteData(color_hi);
-            ST7789_WriteData(color_lo);
-        }
-
+        ST7789_PushColor(color, w);
         ST7789_Deselect();
     }
 }
 
+// ST7789_LineRun
+// Sends one straight run of a line as a single window. The display
+// must already be selected.
+// Param bool "steep": true if the run is vertical.
+// Param uint16_t "start": first pixel along the run.
+// Param uint16_t "len": number of pixels.
+// Param uint16_t "minor": row (or column if steep) of the run.
+// Param uint16_t "color": color of line.
+// Return: void
+static void ST7789_LineRun(bool steep, uint16_t start, uint16_t len, uint16_t minor, uint16_t color) {
+    uint16_t majorMax = steep ? Y_MAX : X_MAX;
+    uint16_t minorMax = steep ? X_MAX : Y_MAX;
+
+    if (minor >= minorMax || start >= majorMax) {
+        return;
+    }
+
+    if (start + len > majorMax) {
+        len = majorMax - start;
+    }
+
+    if (steep) {
+        ST7789_SetWindow(minor, start, 1, len);
+    } else {
+        ST7789_SetWindow(start, minor, len, 1);
+    }
+    ST7789_PushColor(color, len);
+}
+
 // ST7789_Line
-// Draws a line from point 1 to point 2.
+// Draws a line from point 1 to point 2. Bresenham steps are collected
+// into horizontal (or vertical, if steep) runs so each run costs one
+// window instead of one per pixel, and chip select is held for the
+// whole line.
 // Param uint16_t x0: x-coord of first point.
 // Param uint16_t y0: y-coord of first point.
 // Param uint16_t x1: x-coord of second point.
@@ -216,24 +482,86 @@ void ST7789_Line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t co
         ystep = -1;
     }
 
+    uint16_t runStart = x0;
+
+    ST7789_Select();
     for (; x0 <= x1; x0++)
     {
-        if (steep)
-        {
-            ST7789_DrawPixel(y0, x0, color);
-        }
-        else
+        err -= dy;
+
+        // The run ends where the minor axis steps, or at the last pixel
+        if (err < 0 || x0 == x1)
         {
-            ST7789_DrawPixel(x0, y0, color);
+            ST7789_LineRun(steep, runStart, x0 - runStart + 1, y0, color);
+            runStart = x0 + 1;
         }
 
-        err -= dy;
         if (err < 0)
         {
             y0 += ystep;
             err += dx;
         }
     }
+    ST7789_Deselect();
+}
+
+// ST7789_DMA_StartChunk
+// Queues the next (up to ST7789_DMA_MAX_TRANSFER) pixels on the SSI0 TX channel.
+// In 12-bit mode each chunk replays the packed dmaPattern bytes instead.
+// Return: void
+static void ST7789_DMA_StartChunk(void) {
+    uint32_t limit = dmaRewind ? ST7789_DMA_PATTERN_BYTES : ST7789_DMA_MAX_TRANSFER;
+    uint32_t count = (dmaRemaining > limit) ? limit : dmaRemaining;
+
+    if (dmaRewind) {
+        uDMAChannelControlSet(UDMA_CHANNEL_SSI0TX | UDMA_PRI_SELECT,
+                              UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_4);
+    } else {
+        uDMAChannelControlSet(UDMA_CHANNEL_SSI0TX | UDMA_PRI_SELECT,
+                              UDMA_SIZE_16 | (dmaIncrement ? UDMA_SRC_INC_16 : UDMA_SRC_INC_NONE) |
+                              UDMA_DST_INC_NONE | UDMA_ARB_4);
+    }
+    uDMAChannelTransferSet(UDMA_CHANNEL_SSI0TX | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           (void *)dmaSource, (void *)(SPI_A_BASE + SSI_O_DR), count);
+
+    if (dmaIncrement && !dmaRewind) {
+        dmaSource += count;
+    }
+    dmaRemaining -= count;
+
+    uDMAChannelEnable(UDMA_CHANNEL_SSI0TX);
+}
+
+// ST7789_DMA_Start
+// Opens a window and starts streaming pixels to it. SetWindow leaves
+// SSI0 in 16-bit frames so the uDMA can move RGB565 words as they are.
+// Param int16_t "x", "y", "w", "h": window, already clipped.
+// Param uint16_t* "source": first pixel.
+// Param bool "increment": false to repeat the same pixel.
+// Return: void
+static void ST7789_DMA_Start(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *source, bool increment) {
+    ST7789_Select();
+    ST7789_SetWindow(x, y, w, h);
+
+    dmaSource = source;
+    dmaIncrement = increment;
+    dmaRewind = 0;
+    dmaRemaining = (uint32_t)w * (uint32_t)h;
+
+    // RGB444 fills stream bytes of the packed pattern, the pattern length
+    // is a multiple of three so every chunk starts on a pixel pair
+    if (colorBits == ST7789_COLOR_12BIT) {
+        dmaSource = (const uint16_t *)dmaPattern;
+        dmaRewind = 1;
+        dmaRemaining = (dmaRemaining * 3 + 1) / 2;
+        statPixelBytes += dmaRemaining;
+    } else {
+        statPixelBytes += 2 * dmaRemaining;
+    }
+    dmaActive = 1;
+
+    SSIDMAEnable(SPI_A_BASE, SSI_DMA_TX);
+    ST7789_DMA_StartChunk();
 }
 
 // delay_ms
@@ -252,6 +580,12 @@ void delay_ms(uint32_t ms) {
 // Initializes the TFT display to begin being able to be drawn to.
 // Return: void
 void ST7789_Init() {
+#ifndef ST7789_HOST
+    // Start the cycle counter used to time the bus
+    HWREG(ST7789_DEMCR) |= ST7789_DEMCR_TRCENA;
+    HWREG(ST7789_DWT_CTRL) |= ST7789_DWT_CYCCNTENA;
+#endif
+
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
     GPIOPinTypeGPIOOutput(ST7789_PIN_PORT_BASE, ST7789_CS_PIN);
     GPIOPinTypeGPIOOutput(ST7789_PIN_PORT_BASE, ST7789_DC_PIN);
@@ -267,7 +601,7 @@ void ST7789_Init() {
     ST7789_WriteCommand(ST7789_SLPOUT_ADDR);
     delay_ms(500);
     ST7789_WriteCommand(ST7789_COLMOD_ADDR);
-    ST7789_WriteData(0x55);
+    ST7789_WriteData((colorBits == ST7789_COLOR_12BIT) ? 0x53 : 0x55);
 
     ST7789_WriteCommand(ST7789_CASET_ADDR);
     ST7789_WriteData(0x00);
@@ -301,6 +635,352 @@ void ST7789_Init() {
     delay_ms(120);
     ST7789_Fill(0x0000);
     ST7789_Deselect();
+
+    ST7789_DMA_Init();
+}
+
+// ST7789_BeginWindow
+// Selects the display and opens a window for streaming pixels with
+// ST7789_WriteColor / ST7789_WritePixels. Pixels fill the window row by row.
+// Param int16_t "x", "y": top left corner.
+// Param int16_t "w", "h": size of window.
+// Return: void
+void ST7789_BeginWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    ST7789_Select();
+    ST7789_SetWindow(x, y, w, h);
+}
+
+// ST7789_WriteColor
+// Streams count pixels of one color into the open window.
+// Param uint16_t "color": color of pixels.
+// Param uint32_t "count": number of pixels.
+// Return: void
+void ST7789_WriteColor(uint16_t color, uint32_t count) {
+    ST7789_PushColor(color, count);
+}
+
+// ST7789_WritePixels
+// Streams count RGB565 pixels into the open window.
+// Param uint16_t* "pixels": pixel data.
+// Param uint32_t "count": number of pixels.
+// Return: void
+void ST7789_WritePixels(const uint16_t *pixels, uint32_t count) {
+    ST7789_PushPixels(pixels, count);
+}
+
+// ST7789_EndWindow
+// Deselects the display once the streamed pixels are out.
+// Return: void
+void ST7789_EndWindow(void) {
+    ST7789_Deselect();
+}
+
+// ST7789_GetTransferStats
+// Gets the number of windows opened and bytes of commands, parameters
+// and pixel data sent since the last reset.
+// Param uint32_t* "windows", "bytes": outputs, either may be 0.
+// Return: void
+void ST7789_GetTransferStats(uint32_t *windows, uint32_t *bytes) {
+    if (windows) {
+        *windows = statWindows;
+    }
+    if (bytes) {
+        *bytes = statCommandBytes + statPixelBytes;
+    }
+}
+
+// ST7789_GetStats
+// Gets all transfer counters since the last reset. Counters wrap, so
+// take differences between two reads rather than resetting every frame.
+// Param ST7789Stats_t* "stats": output.
+// Return: void
+void ST7789_GetStats(ST7789Stats_t *stats) {
+    stats->windows = statWindows;
+    stats->commandBytes = statCommandBytes;
+    stats->pixelBytes = statPixelBytes;
+    stats->busyCycles = statBusyCycles;
+}
+
+// ST7789_ResetTransferStats
+// Clears the transfer counters.
+// Return: void
+void ST7789_ResetTransferStats(void) {
+    statWindows = 0;
+    statCommandBytes = 0;
+    statPixelBytes = 0;
+    statBusyCycles = 0;
+}
+
+// ST7789_WriteScrollStart
+// Sends VSCRSADD for the current scroll offset. The display must be selected.
+// Return: void
+static void ST7789_WriteScrollStart(void) {
+    uint16_t line = ST7789_Y_OFFSET + scrollTop + scrollOffset;
+    uint8_t vscrsadd[2] = { (line >> 8) & 0xFF, (line >> 0) & 0xFF };
+
+    ST7789_WriteCommand(ST7789_VSCRSADD_ADDR);
+    ST7789_WriteParams(vscrsadd, 2);
+}
+
+// ST7789_SetScrollArea
+// Sets rows [top, top + height) up for hardware vertical scrolling, the
+// rest of the screen stays fixed. The area starts unscrolled.
+// Param uint16_t "top": first row of the area.
+// Param uint16_t "height": number of rows in the area.
+// Return: void
+void ST7789_SetScrollArea(uint16_t top, uint16_t height) {
+    if (top >= Y_MAX || height == 0) {
+        return;
+    }
+
+    if (top + height > Y_MAX) {
+        height = Y_MAX - top;
+    }
+
+    scrollTop = top;
+    scrollHeight = height;
+    scrollOffset = 0;
+
+    // Fixed areas are in memory rows, so the hidden offset rows are part of them
+    uint16_t tfa = ST7789_Y_OFFSET + top;
+    uint16_t bfa = ST7789_MEMORY_ROWS - tfa - height;
+    uint8_t vscrdef[6] = {
+        (tfa >> 8) & 0xFF, (tfa >> 0) & 0xFF,
+        (height >> 8) & 0xFF, (height >> 0) & 0xFF,
+        (bfa >> 8) & 0xFF, (bfa >> 0) & 0xFF
+    };
+
+    ST7789_Select();
+    ST7789_WriteCommand(ST7789_VSCRDEF_ADDR);
+    ST7789_WriteParams(vscrdef, 6);
+    ST7789_WriteScrollStart();
+    SPI_WaitIdle(SPI_A_BASE);
+    ST7789_Deselect();
+}
+
+// ST7789_ScrollAdvance
+// Scrolls the area by a number of rows. The rows that scroll out of one
+// end come back in at the other, new content is drawn into them with
+// ST7789_ScrollRowY(height - rows) and after.
+// Param uint16_t "rows": rows to scroll by.
+// Return: void
+void ST7789_ScrollAdvance(uint16_t rows) {
+    if (scrollHeight == 0) {
+        return;
+    }
+
+    scrollOffset = (scrollOffset + rows) % scrollHeight;
+
+    ST7789_Select();
+    ST7789_WriteScrollStart();
+    SPI_WaitIdle(SPI_A_BASE);
+    ST7789_Deselect();
+}
+
+// ST7789_ScrollRowY
+// Gets the drawing y of a row of the scroll area as currently shown.
+// Consecutive rows are not contiguous in memory where the area wraps,
+// so draw row by row or keep line heights a divisor of the area height.
+// Param uint16_t "row": row counted from the start of the area.
+// Return: int16_t, y to pass to drawing functions, -1 if there is no area.
+int16_t ST7789_ScrollRowY(uint16_t row) {
+    if (scrollHeight == 0) {
+        return -1;
+    }
+
+    return scrollTop + (scrollOffset + row) % scrollHeight;
+}
+
+// ST7789_ScrollDisable
+// Returns the display to normal, unscrolled mode.
+// Return: void
+void ST7789_ScrollDisable(void) {
+    scrollOffset = 0;
+
+    ST7789_Select();
+    ST7789_WriteScrollStart();
+    ST7789_WriteCommand(ST7789_NORON_ADDR);
+    SPI_WaitIdle(SPI_A_BASE);
+    ST7789_Deselect();
+
+    scrollHeight = 0;
+}
+
+// ST7789_SetTearingEffect
+// Turns the TE output on, pulsing at the start of vertical blanking, or off.
+// Param bool "enable": true to output TE.
+// Return: void
+void ST7789_SetTearingEffect(bool enable) {
+    ST7789_Select();
+    if (enable) {
+        ST7789_WriteCommand(ST7789_TEON_ADDR);
+        ST7789_WriteData(0x00);
+    } else {
+        ST7789_WriteCommand(ST7789_TEOFF_ADDR);
+    }
+    SPI_WaitIdle(SPI_A_BASE);
+    ST7789_Deselect();
+}
+
+// ST7789_SetTearScanline
+// Moves the TE pulse to when the panel reaches a scanline, e.g. the
+// first row a partial update needs to stay ahead of.
+// Param uint16_t "line": frame memory row.
+// Return: void
+void ST7789_SetTearScanline(uint16_t line) {
+    uint8_t tescan[2] = { (line >> 8) & 0xFF, (line >> 0) & 0xFF };
+
+    ST7789_Select();
+    ST7789_WriteCommand(ST7789_TESCAN_ADDR);
+    ST7789_WriteParams(tescan, 2);
+    SPI_WaitIdle(SPI_A_BASE);
+    ST7789_Deselect();
+}
+
+// ST7789_DMA_Init
+// Sets up the uDMA controller and the SSI0 TX channel for display transfers.
+// ST7789_DMA_Handler still needs to be added as an aperiodic event on
+// ST7789_DMA_INTERRUPT for the DMA functions to complete.
+// Return: void
+void ST7789_DMA_Init(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA));
+
+    uDMAEnable();
+    uDMAControlBaseSet(DMAControlTable);
+
+    uDMAChannelAssign(UDMA_CH11_SSI0TX);
+    uDMAChannelAttributeDisable(UDMA_CHANNEL_SSI0TX, UDMA_ATTR_ALL);
+
+    dmaActive = 0;
+    G8RTOS_InitSemaphore(&dmaDone, 0);
+}
+
+// ST7789_DMA_Handler
+// SSI0 interrupt, fires when the uDMA finishes a chunk. Queues the next
+// chunk or signals the waiting thread when the whole transfer is queued.
+// Return: void
+void ST7789_DMA_Handler(void) {
+    if (!dmaActive || uDMAChannelModeGet(UDMA_CHANNEL_SSI0TX | UDMA_PRI_SELECT) != UDMA_MODE_STOP) {
+        return;
+    }
+
+    if (dmaRemaining) {
+        ST7789_DMA_StartChunk();
+    } else {
+        SSIDMADisable(SPI_A_BASE, SSI_DMA_TX);
+        dmaActive = 0;
+        G8RTOS_SignalSemaphore(&dmaDone);
+    }
+}
+
+// ST7789_DMA_FillRectangleAsync
+// Starts filling a rectangle with one color from a fixed DMA source and
+// returns right away. The caller must hold the SPI bus until ST7789_DMA_Wait.
+// Param int16_t "x", "y": top left corner.
+// Param int16_t "w", "h": size of rectangle.
+// Param uint16_t "color": fill color.
+// Return: void
+void ST7789_DMA_FillRectangleAsync(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+
+    if (x + w > X_MAX) {
+        w -= x + w - X_MAX;
+    }
+
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+
+    if (y + h > Y_MAX) {
+        h -= y + h - Y_MAX;
+    }
+
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+
+    dmaColor = color;
+    if (colorBits == ST7789_COLOR_12BIT) {
+        ST7789_PackColor(dmaPattern, ST7789_DMA_PATTERN_BYTES, color);
+    }
+    ST7789_DMA_Start(x, y, w, h, &dmaColor, 0);
+}
+
+// ST7789_DMA_BlitAsync
+// Starts copying a w*h block of RGB565 pixels (row-major) to the display
+// and returns right away. The block has to fit on screen and stay valid
+// until ST7789_DMA_Wait.
+// Param int16_t "x", "y": top left corner.
+// Param int16_t "w", "h": size of block.
+// Param uint16_t* "pixels": pixel data.
+// Return: void
+void ST7789_DMA_BlitAsync(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > X_MAX || y + h > Y_MAX) {
+        return;
+    }
+
+    // uDMA cannot repack RGB565, so 12-bit blits are packed by the CPU
+    if (colorBits == ST7789_COLOR_12BIT) {
+        ST7789_Select();
+        ST7789_SetWindow(x, y, w, h);
+        ST7789_PushPixels(pixels, (uint32_t)w * (uint32_t)h);
+        ST7789_Deselect();
+        return;
+    }
+
+    ST7789_DMA_Start(x, y, w, h, pixels, 1);
+}
+
+// ST7789_DMA_Busy
+// Checks whether a DMA transfer is still being queued.
+// Return: bool
+bool ST7789_DMA_Busy(void) {
+    return dmaActive;
+}
+
+// ST7789_DMA_Wait
+// Sleeps until the transfer started by an Async call is done, then
+// lets the last frames drain and releases the display.
+// Return: void
+void ST7789_DMA_Wait(void) {
+    if (dmaActive) {
+        G8RTOS_WaitSemaphore(&dmaDone);
+    } else if (dmaDone > 0) {
+        // Finished before we got here, consume the signal
+        G8RTOS_WaitSemaphore(&dmaDone);
+    } else {
+        return;
+    }
+
+    SPI_WaitIdle(SPI_A_BASE);
+    ST7789_Deselect();
+}
+
+// ST7789_DMA_FillRectangle
+// Fills a rectangle by DMA, sleeping the calling thread until done.
+// Param int16_t "x", "y": top left corner.
+// Param int16_t "w", "h": size of rectangle.
+// Param uint16_t "color": fill color.
+// Return: void
+void ST7789_DMA_FillRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    ST7789_DMA_FillRectangleAsync(x, y, w, h, color);
+    ST7789_DMA_Wait();
+}
+
+// ST7789_DMA_Blit
+// Copies a block of pixels by DMA, sleeping the calling thread until done.
+// Param int16_t "x", "y": top left corner.
+// Param int16_t "w", "h": size of block.
+// Param uint16_t* "pixels": pixel data.
+// Return: void
+void ST7789_DMA_Blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+    ST7789_DMA_BlitAsync(x, y, w, h, pixels);
+    ST7789_DMA_Wait();
 }
 
 // ST7789_DrawPixel
@@ -313,8 +993,7 @@ void ST7789_DrawPixel(uint16_t x, uint16_t y, uint16_t color) {
     if (x < X_MAX && y < Y_MAX) {
         ST7789_Select();
         ST7789_SetWindow(x, y, 1, 1);
-        ST7789_WriteData(color >> 8);
-        ST7789_WriteData(color & 0xFF);
+        ST7789_PushColor(color, 1);
         ST7789_Deselect();
     }
 }
@@ -327,6 +1006,29 @@ void ST7789_Fill(uint16_t color) {
     ST7789_DrawRectangle(0, 0, X_MAX, Y_MAX, color);
 }
 
+// ST7789_SetColorDepth
+// Switches the interface pixel format. Frame memory is left as it is,
+// only pixels written afterwards are sent in the new format.
+// Param uint8_t "bits": ST7789_COLOR_16BIT or ST7789_COLOR_12BIT.
+// Return: void
+void ST7789_SetColorDepth(uint8_t bits) {
+    ST7789_DMA_Wait();
+    colorBits = (bits == ST7789_COLOR_12BIT) ? ST7789_COLOR_12BIT : ST7789_COLOR_16BIT;
+
+    ST7789_Select();
+    ST7789_WriteCommand(ST7789_COLMOD_ADDR);
+    ST7789_WriteData((colorBits == ST7789_COLOR_12BIT) ? 0x53 : 0x55);
+    SPI_WaitIdle(SPI_A_BASE);
+    ST7789_Deselect();
+}
+
+// ST7789_GetColorDepth
+// Gets the interface pixel format.
+// Return: uint8_t, ST7789_COLOR_16BIT or ST7789_COLOR_12BIT
+uint8_t ST7789_GetColorDepth(void) {
+    return colorBits;
+}
+
 // ST7789_DrawLine
 // Draws a line from point 1 to point 2.
 // Param uint16_t x0: x-coord of first point.
@@ -357,7 +1059,6 @@ void ST7789_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 // Param uint16_t color: color of line.
 // Return: void
 void ST7789_DrawRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-    uint8_t color_hi, color_lo;
     ST7789_Select();
 
     if (x < 0) {
@@ -376,16 +1077,14 @@ void ST7789_DrawRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c
         h -= y + h - Y_MAX;
     }
 
-    ST7789_SetWindow(x, y, w, h);
+    if (w <= 0 || h <= 0) {
+        ST7789_Deselect();
+        return;
+    }
 
-    color_hi = color >> 8;
-    color_lo = color & 0xFF;
+    ST7789_SetWindow(x, y, w, h);
 
-    uint32_t num_p = (uint32_t)w * (uint32_t)h;
-    while (num_p--) {
-        ST7789_WriteData(color_hi);
-        ST7789_WriteData(color_lo);
-    }
+    ST7789_PushColor(color, (uint32_t)w * (uint32_t)h);
     ST7789_Deselect();
 }
 
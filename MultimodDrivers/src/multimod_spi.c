@@ -13,6 +13,7 @@
 
 #include <inc/tm4c123gh6pm.h>
 #include <inc/hw_ssi.h>
+#include <inc/hw_types.h>
 
 /************************************Includes***************************************/
 
@@ -112,5 +113,97 @@ void SPI_ReadMultiple(uint32_t mod, uint32_t* data, uint8_t num_bytes) {
     return;
 }
 
+// SPI_WaitIdle
+// Waits for the last frame to finish shifting out, then throws away
+// whatever was clocked into the RX FIFO during the writes so it can't
+// be mistaken for a reply by the next read.
+// Param uint32_t "mod": base address of module
+// Return: void
+void SPI_WaitIdle(uint32_t mod) {
+    uint32_t discard;
+
+    while(SSIBusy(mod));
+    while(SSIDataGetNonBlocking(mod, &discard));
+}
+
+// SPI_SetDataWidth
+// Changes the SSI frame size. Waits for the bus to go idle first since
+// the module has to be disabled while it is reconfigured.
+// Param uint32_t "mod": base address of module
+// Param uint8_t "bits": frame size, [4..16]
+// Return: void
+void SPI_SetDataWidth(uint32_t mod, uint8_t bits) {
+    SPI_WaitIdle(mod);
+
+    HWREG(mod + SSI_O_CR1) &= ~SSI_CR1_SSE;
+    HWREG(mod + SSI_O_CR0) = (HWREG(mod + SSI_O_CR0) & ~SSI_CR0_DSS_M) | (bits - 1);
+    HWREG(mod + SSI_O_CR1) |= SSI_CR1_SSE;
+}
+
+// SPI_WriteBurst
+// Writes a block of bytes keeping the TX FIFO full (SSIDataPut only
+// waits when the FIFO has no room). Only waits for the bus to go idle
+// once, after the last byte.
+// Param uint32_t "mod": base address of module
+// Param uint8_t* "data": pointer to an array of bytes
+// Param uint32_t "num_bytes": number of bytes to transmit
+// Return: void
+void SPI_WriteBurst(uint32_t mod, const uint8_t* data, uint32_t num_bytes) {
+    while(num_bytes--) {
+        SSIDataPut(mod, *data++);
+    }
+
+    SPI_WaitIdle(mod);
+}
+
+// SPI_WriteRepeat16
+// Writes the same 16-bit value count times, keeping the TX FIFO full.
+// If the module is set to 16-bit frames each value is one frame,
+// otherwise it is sent as two bytes, MSB first. Used for solid color fills.
+// Param uint32_t "mod": base address of module
+// Param uint16_t "value": value to repeat
+// Param uint32_t "count": number of times to send value
+// Return: void
+void SPI_WriteRepeat16(uint32_t mod, uint16_t value, uint32_t count) {
+    if ((HWREG(mod + SSI_O_CR0) & SSI_CR0_DSS_M) == SSI_CR0_DSS_16) {
+        while(count--) {
+            SSIDataPut(mod, value);
+        }
+    } else {
+        uint8_t hi = value >> 8;
+        uint8_t lo = value & 0xFF;
+
+        while(count--) {
+            SSIDataPut(mod, hi);
+            SSIDataPut(mod, lo);
+        }
+    }
+
+    SPI_WaitIdle(mod);
+}
+
+// SPI_WriteBurst16
+// Writes a block of 16-bit values, keeping the TX FIFO full.
+// If the module is set to 16-bit frames each value is one frame,
+// otherwise it is sent as two bytes, MSB first.
+// Param uint32_t "mod": base address of module
+// Param uint16_t* "data": pointer to an array of values
+// Param uint32_t "count": number of values to transmit
+// Return: void
+void SPI_WriteBurst16(uint32_t mod, const uint16_t* data, uint32_t count) {
+    if ((HWREG(mod + SSI_O_CR0) & SSI_CR0_DSS_M) == SSI_CR0_DSS_16) {
+        while(count--) {
+            SSIDataPut(mod, *data++);
+        }
+    } else {
+        while(count--) {
+            SSIDataPut(mod, *data >> 8);
+            SSIDataPut(mod, *data++ & 0xFF);
+        }
+    }
+
+    SPI_WaitIdle(mod);
+}
+
 /********************************Public Functions***********************************/
 
@@ -13,11 +13,22 @@
 #include "./MultimodDrivers/multimod.h"
 
 #include "./threads.h"
+#include "./MiscFunctions/Graphics/inc/display_server.h"
+#include "./MiscFunctions/Graphics/inc/tile_renderer.h"
+#include "./MiscFunctions/Graphics/inc/widget.h"
+#include "./MiscFunctions/Graphics/inc/frame_pacer.h"
+#include "./G8RTOS/G8RTOS_IPCStress.h"
 #include "driverlib/interrupt.h"
 
 /************************************Includes***************************************/
 
 /*************************************Defines***************************************/
+
+// Set to 1 to run the MPMC FIFO stress test instead of the game, the
+// outcome is read back with IPCStress_GetResult from the debugger
+#define IPC_STRESS_TEST     0
+#define IPC_STRESS_FIFO     3
+
 /*************************************Defines***************************************/
 
 /********************************Public Variables***********************************/
@@ -45,23 +56,39 @@ int main(void)
     G8RTOS_InitSemaphore(&sem_Joystick_Debounce, 1);
 
 
-    G8RTOS_InitFIFO(BUTTONS_FIFO);
+    G8RTOS_InitTopic(BUTTONS_TOPIC);
     G8RTOS_InitFIFO(JOYSTICK_FIFO);
     G8RTOS_InitFIFO(JOYSTICK_P_FIFO);
+    G8RTOS_InitBufferPool();
+    DisplayServer_Init(&sem_SPIA);
+    TileRenderer_Init(background);
+    Widget_Init();
+    FramePacer_Init();
 
     G8RTOS_AddThread(Idle_Thread, 255, "idle\0");
+#if IPC_STRESS_TEST
+    IPCStress_Init(IPC_STRESS_FIFO);
+#else
     G8RTOS_AddThread(Display_Thread, 250, "display\0");
     G8RTOS_AddThread(Read_Buttons, 251, "buttons\0");
     G8RTOS_AddThread(text_Thread,252, "text\0");
     G8RTOS_AddThread(Speaker_Thread, 253, "speaker\0");
+    G8RTOS_AddThread(DisplayServer_Thread, 254, "dispsrv\0");
+#endif
 
     // add periodic and aperiodic events here (check multimod_mic.h and multimod_buttons.h for defines)
 
 
     G8RTOS_Add_APeriodicEvent(Button_Handler,4, INT_GPIOE );
     G8RTOS_Add_APeriodicEvent(DAC_Timer_Handler,5, DAC_INTERRUPT );
+    G8RTOS_Add_APeriodicEvent(ST7789_DMA_Handler, 3, ST7789_DMA_INTERRUPT);
 
     G8RTOS_Add_PeriodicEvent(Update_Joystick, 50, 1);
+#if FRAME_PACER_USE_TE
+    G8RTOS_Add_APeriodicEvent(FramePacer_TE_Handler, 4, FRAME_TE_INTERRUPT);
+#else
+    G8RTOS_Add_PeriodicEvent(FramePacer_Tick, FRAME_PACER_PERIOD_MS, 2);
+#endif
 
     G8RTOS_Launch();
     while (1);
@@ -0,0 +1,73 @@
+// sprites.c
+// Generated by tools/sprite_convert.py from assets/mole.png assets/mallet.png assets/mallet_hit.png, do not edit
+
+#include "sprites.h"
+
+// mole: 14x15, 2 colors, 46 bytes of runs
+static const uint16_t mole_palette[2] = {
+    0x020F, 0x0000,
+};
+
+static const uint16_t mole_rows[15] = {
+    0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22,
+    32, 42, 44,
+};
+
+static const uint8_t mole_data[46] = {
+    14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0,
+    14, 0, 14, 0, 14, 0, 3, 0, 2, 1, 4, 0, 2, 1, 3, 0,
+    3, 0, 2, 1, 4, 0, 2, 1, 3, 0, 14, 0, 14, 0,
+};
+
+const Sprite_t sprite_mole = {
+    .w = 14, .h = 15,
+    .key = SPRITE_NO_KEY, .colors = 2,
+    .palette = mole_palette, .rows = mole_rows, .data = mole_data
+};
+
+// mallet: 9x20, 2 colors, 108 bytes of runs
+static const uint16_t mallet_palette[2] = {
+    0x0000, 0x051F,
+};
+
+static const uint16_t mallet_rows[20] = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66,
+    72, 78, 84, 90, 96, 98, 100, 102,
+};
+
+static const uint8_t mallet_data[108] = {
+    3, 0, 3, 1, 3, 0, 3, 0, 3, 1, 3, 0, 3, 0, 3, 1,
+    3, 0, 3, 0, 3, 1, 3, 0, 3, 0, 3, 1, 3, 0, 3, 0,
+    3, 1, 3, 0, 3, 0, 3, 1, 3, 0, 3, 0, 3, 1, 3, 0,
+    3, 0, 3, 1, 3, 0, 3, 0, 3, 1, 3, 0, 3, 0, 3, 1,
+    3, 0, 3, 0, 3, 1, 3, 0, 3, 0, 3, 1, 3, 0, 3, 0,
+    3, 1, 3, 0, 3, 0, 3, 1, 3, 0, 3, 0, 3, 1, 3, 0,
+    9, 1, 9, 1, 9, 1, 3, 0, 3, 1, 3, 0,
+};
+
+const Sprite_t sprite_mallet = {
+    .w = 9, .h = 20,
+    .key = 0, .colors = 2,
+    .palette = mallet_palette, .rows = mallet_rows, .data = mallet_data
+};
+
+// mallet_hit: 20x9, 2 colors, 42 bytes of runs
+static const uint16_t mallet_hit_palette[2] = {
+    0x0000, 0x001F,
+};
+
+static const uint16_t mallet_hit_rows[9] = {
+    0, 6, 12, 18, 24, 26, 28, 30, 36,
+};
+
+static const uint8_t mallet_hit_data[42] = {
+    1, 0, 3, 1, 16, 0, 1, 0, 3, 1, 16, 0, 1, 0, 3, 1,
+    16, 0, 1, 0, 3, 1, 16, 0, 20, 1, 20, 1, 20, 1, 1, 0,
+    3, 1, 16, 0, 1, 0, 3, 1, 16, 0,
+};
+
+const Sprite_t sprite_mallet_hit = {
+    .w = 20, .h = 9,
+    .key = 0, .colors = 2,
+    .palette = mallet_hit_palette, .rows = mallet_hit_rows, .data = mallet_hit_data
+};
@@ -0,0 +1,13 @@
+// sprites.h
+// Generated by tools/sprite_convert.py from assets/mole.png assets/mallet.png assets/mallet_hit.png, do not edit
+
+#ifndef SPRITES_H_
+#define SPRITES_H_
+
+#include "MiscFunctions/Graphics/inc/sprite.h"
+
+extern const Sprite_t sprite_mole;
+extern const Sprite_t sprite_mallet;
+extern const Sprite_t sprite_mallet_hit;
+
+#endif /* SPRITES_H_ */
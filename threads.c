@@ -9,6 +9,12 @@
 
 #include "./MultimodDrivers/multimod.h"
 #include "./MiscFunctions/Signals/inc/goertzel.h"
+#include "./MiscFunctions/Graphics/inc/display_server.h"
+#include "./MiscFunctions/Graphics/inc/tile_renderer.h"
+#include "./MiscFunctions/Graphics/inc/widget.h"
+#include "./MiscFunctions/Graphics/inc/frame_pacer.h"
+#include "./MiscFunctions/Graphics/inc/perf_overlay.h"
+#include "./sprites.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -30,11 +36,14 @@ int16_t malletY = 160;
 int16_t score = 0;
 int16_t gameTime = 1000;
 int16_t highScores[5];
+int32_t hudWidget = WIDGET_ROOT;     // score, time and time bar, hidden on the endscreen
 
 typedef struct {
     int16_t x;
     int16_t y;
     uint8_t isVisible;
+    int32_t item;       // hole in the tile renderer
+    int32_t sprite;     // mole sprite in the tile renderer
 } Mole;
 
 Mole moles[8];
@@ -67,6 +76,7 @@ void Idle_Thread(void) {
 void Speaker_Thread(void) {
 
     uint8_t buttons = 0;
+    int32_t buttons_sub = G8RTOS_Subscribe(BUTTONS_TOPIC);
     
     while (1)
     {
@@ -77,7 +87,7 @@ void Speaker_Thread(void) {
         sleep(15);
         // Get buttons
         //buttons = ~(MultimodButtons_Get());
-        buttons = G8RTOS_ReadFIFO(BUTTONS_FIFO);
+        buttons = G8RTOS_ReadTopic(BUTTONS_TOPIC, buttons_sub);
         // clear button interrupt
         GPIOIntClear(BUTTONS_INT_GPIO_BASE,BUTTONS_INT_PIN);
         // check which buttons are pressed
@@ -107,67 +117,34 @@ void Speaker_Thread(void) {
 //print scores and time
 void text_Thread(void) {
 
-    int16_t prevScore=0;
-    int16_t prevTime=100;
-    char score_str[3];
-    score_str[0] = 0;
-    score_str[1] = 0;
+    int16_t prevScore=-1;
+    int16_t prevTime=-1;
+
+    // numbers only resend the digits that change
+    int32_t hud = Widget_AddGroup(WIDGET_ROOT);
+    int32_t scoreNumber = Widget_AddNumber(hud, 20, 20, "SCORE:", ST7789_WHITE, background, 2);
+    int32_t timeNumber = Widget_AddNumber(hud, 140, 20, "TIME:", ST7789_WHITE, background, 2);
+    int32_t timeBar = Widget_AddProgress(hud, 20, 8, 200, 4, ST7789_WHITE, ST7789_BROWN, 1000);
+    hudWidget = hud;
 
-    char time_str[3];
     while(1){
 
         if(gameTime !=0){ //while game is running
 
-            if(score == 0){
-                sprintf(score_str, "%d", score); // Convert score to a string
-                 display_setCursor(20,20); // Set the cursor position
-                 display_print('S');
-                 display_print('C');
-                 display_print('O');
-                 display_print('R');
-                 display_print('E');
-                 display_print(':');
-                 display_print('0');
-            }
-
             if(prevScore != score ){ //only run when score changes
-                ST7789_DrawRectangle(80, 5, 50,50,background);
-                sleep(5);
-                ST7789_DrawRectangle(80, 5, 50,50,background); // doubly cover old score
-
-                sprintf(score_str, "%d", score); // Convert score to a string
-                display_setCursor(20,20); // Set the cursor position
-                display_print('S');
-                display_print('C');
-                display_print('O');
-                display_print('R');
-                display_print('E');
-                display_print(':');
-
-                display_print(score_str[0]);
-                display_print(score_str[1]);
+                Widget_SetValue(scoreNumber, score);
                 prevScore = score;
             }
 
             if(prevTime != gameTime/10 ){ // only run when timer changes by 10
-                ST7789_DrawRectangle(180, 5, 50,20,background);
-                sleep(5);
-
-                sprintf(time_str, "%d", gameTime/10); // Convert score to a string
-                display_setCursor(140,20 ); // Set the cursor position
-                display_print('T');
-                display_print('I');
-                display_print('M');
-                display_print('E');
-                display_print(':');
-                display_print(time_str[0]);
-                display_print(time_str[1]);
+                Widget_SetValue(timeNumber, gameTime/10);
+                Widget_SetValue(timeBar, gameTime);
                 prevTime = gameTime/10;
             }
-
-
-            sleep(10);
         }
+
+        // sleep during game over as well, the display server runs below us
+        sleep(10);
     }
 }
 
@@ -180,17 +157,12 @@ void Display_Thread(void) {
     }
 
     uint32_t readVal;
-    int16_t mag1;
-    int16_t mag2;
-    int16_t prevMalX = 0;
-    int16_t prevMalY = 0;
     uint32_t result;
     int16_t joystickX;
     int16_t joystickY;
     uint8_t buttons = 0;
     uint8_t pressed;
-
-    char score_str[3];
+    int32_t buttons_sub = G8RTOS_Subscribe(BUTTONS_TOPIC);
 
     int16_t contFlag = 0;
 
@@ -212,11 +184,26 @@ void Display_Thread(void) {
          }
 
         for(int i =0; i<8; i++){
-               G8RTOS_WaitSemaphore(&sem_SPIA);
-               ST7789_DrawRectangle(moles[i].x, moles[i].y, 20, 10,ST7789_BROWN );
-               G8RTOS_SignalSemaphore(&sem_SPIA);
+               moles[i].item = TileRenderer_AddRect(moles[i].x, moles[i].y, 20, 10,ST7789_BROWN );
+               moles[i].sprite = TileRenderer_AddSprite(moles[i].x+3, moles[i].y+10, &sprite_mole);
+               TileRenderer_SetVisible(moles[i].sprite, false);
         }
 
+        // mallet goes last so it is drawn over the moles
+        int32_t mallet = TileRenderer_AddSprite(malletX - 3, malletY, &sprite_mallet);
+
+        // endscreen covers everything added before it, hidden until game over
+        int32_t endscreen = Widget_AddGroup(WIDGET_ROOT);
+        Widget_AddPanel(endscreen, 0, 0, X_MAX, Y_MAX, gameOver);
+        Widget_AddLabel(endscreen, 70, 200, "YOUR SCORE:", ST7789_WHITE, ST7789_WHITE, 2);
+        int32_t finalScore = Widget_AddNumber(endscreen, 202, 200, "", ST7789_WHITE, ST7789_WHITE, 2);
+        Widget_AddLabel(endscreen, 70, 150, "HIGH SCORES", ST7789_WHITE, ST7789_WHITE, 2);
+        int32_t scoreList = Widget_AddList(endscreen, 120, 130, 5, -20, ST7789_WHITE, ST7789_WHITE, 2);
+        Widget_SetVisible(endscreen, false);
+
+        // bus statistics, drawn on top of everything with PERF_OVERLAY_SHOW
+        PerfOverlay_Init();
+
         int i = rand() % 8;
 
         moles[i].isVisible = true;
@@ -252,60 +239,32 @@ void Display_Thread(void) {
                 UARTprintf("%d\n" , highScores[i]);
             }
 
-            ST7789_Fill(gameOver); //endscreen
-
-            sprintf(score_str, "%d", score);
-
-
-
-            display_setCursor(70,200 ); // Set the cursor position
-            display_print('Y');
-            display_print('O');
-            display_print('U');
-            display_print('R');
-            display_print(' ');
-            display_print('S');
-            display_print('C');
-            display_print('O');
-            display_print('R');
-            display_print('E');
-            display_print(':');
-            display_print(score_str[0]);
-            display_print(score_str[1]);
-
-            display_setCursor(70,150 );
-            display_print('H');
-            display_print('I');
-            display_print('G');
-            display_print('H');
-            display_print(' ');
-            display_print('S');
-            display_print('C');
-            display_print('O');
-            display_print('R');
-            display_print('E');
-            display_print('S');
-
+            Widget_SetValue(finalScore, score);
             for(int i =0; i < 5; i++){
-                display_setCursor(120,130 - i * 20 );
-                sprintf(score_str, "%d", highScores[i]);
-                display_print(score_str[0]);
-                display_print(score_str[1]);
+                Widget_SetRowNumber(scoreList, i, highScores[i]);
             }
 
+            Widget_SetVisible(hudWidget, false); //endscreen
+            Widget_SetVisible(endscreen, true);
+            DisplayServer_FlushTiles();
+
 
+            // ignore presses made during the game
+            G8RTOS_DrainTopic(BUTTONS_TOPIC, buttons_sub);
 
             while(1){ // wait until button is pressed to restart
                 //G8RTOS_WaitSemaphore(&sem_PCA9555_Debounce);
 
-                buttons = G8RTOS_ReadFIFO(BUTTONS_FIFO);
+                buttons = G8RTOS_ReadTopic(BUTTONS_TOPIC, buttons_sub);
                 //sleep(15);
                 //GPIOIntClear(BUTTONS_INT_GPIO_BASE,BUTTONS_INT_PIN);
 
                 if(buttons & SW1){
                     gameTime = 1000;
                     score = 0;
-                    ST7789_Fill(background);
+                    Widget_SetVisible(endscreen, false);
+                    Widget_SetVisible(hudWidget, true);
+                    DisplayServer_FlushTiles();
                     //G8RTOS_SignalSemaphore(&sem_PCA9555_Debounce);
                     break;
 
@@ -326,9 +285,6 @@ void Display_Thread(void) {
 
                 if(moles[i].isVisible){
                     moles[i].isVisible = false;
-                    G8RTOS_WaitSemaphore(&sem_SPIA);
-                    ST7789_DrawRectangle(moles[i].x+3, moles[i].y+10, 14, 15,background );
-                    G8RTOS_SignalSemaphore(&sem_SPIA);
                 }
 
             }
@@ -340,21 +296,6 @@ void Display_Thread(void) {
         pressed = JOYSTICK_GetPress();
 
 
-        G8RTOS_WaitSemaphore(&sem_SPIA);
-
-        if(!pressed){ //delete old mallet position
-                    ST7789_DrawRectangle(malletX, malletY, 3, 20,background );
-                    ST7789_DrawRectangle(malletX - 3, malletY + 16,9 , 3,background );
-                }else{
-
-                    ST7789_DrawRectangle(malletX, malletY, 20+20, 3+5,background );
-                    ST7789_DrawRectangle(malletX + 1, malletY - 4,3 +5, 9+5,background );
-                }
-//        ST7789_DrawRectangle(prevMalX, prevMalY, 3, 20,ST7789_BLACK );
-//        ST7789_DrawRectangle(malletX - 3, malletY + 16,9 , 3,ST7789_BLACK );
-        G8RTOS_SignalSemaphore(&sem_SPIA);
-
-
 
 
         result = G8RTOS_ReadFIFO(JOYSTICK_FIFO); //update location
@@ -394,34 +335,34 @@ void Display_Thread(void) {
              }
 
 
-        G8RTOS_WaitSemaphore(&sem_SPIA);
-
         if(!pressed){
 
-            //redraw mallet
+            //move mallet, the tiles it leaves are repainted from the display list
 
-            ST7789_DrawRectangle(malletX, malletY, 3, 20,ST7789_ORANGE );
-            ST7789_DrawRectangle(malletX - 3, malletY + 16,9 , 3,ST7789_ORANGE );
+            TileRenderer_SetSprite(mallet, &sprite_mallet);
+            TileRenderer_SetRect(mallet, malletX - 3, malletY, 0, 0);
         }else{
 
 //            draw hit mallet
 
 
-            ST7789_DrawRectangle(malletX, malletY, 20, 3,ST7789_RED );
-            ST7789_DrawRectangle(malletX + 1, malletY - 4,3 , 9,ST7789_RED );
+            TileRenderer_SetSprite(mallet, &sprite_mallet_hit);
+            TileRenderer_SetRect(mallet, malletX, malletY - 4, 0, 0);
+            DisplayServer_FlushTiles();
             sleep(10);
 
+            // detect hit, the 2x2 box ending on the mallet point keeps the
+            // old hit area that reached one pixel past the mole sprite
+            int32_t hits[4];
+            uint32_t numHits = TileRenderer_Query(malletX - 1, malletY - 1, 2, 2, hits, 4);
             for(int i =0; i < 8; i++){
-                if(moles[i].isVisible){ //detect hit
-                    if((malletX >= moles[i].x +3 && malletX <= moles[i].x + 17) && (malletY >= moles[i].y + 10 && malletY <= moles[i].y + 25)){
+                for(uint32_t j = 0; j < numHits; j++){
+                    if(moles[i].isVisible && hits[j] == moles[i].sprite){
                         moles[i].isVisible = false;
                         moleTimer = 0;
                         contFlag = 1;
 
-                        ST7789_DrawRectangle(moles[i].x+3, moles[i].y+10, 14, 15,background );
                         score++;
-
-                        //ST7789_DrawRectangle(180,180, 100,100, ST7789_BLUE);
                     }
                 }
             }
@@ -429,10 +370,7 @@ void Display_Thread(void) {
 
 
             sleep(10);
-            ST7789_DrawRectangle(malletX, malletY, 20, 3,background );
-            ST7789_DrawRectangle(malletX + 1, malletY - 4,3 , 9,background );
         }
-        G8RTOS_SignalSemaphore(&sem_SPIA);
 
 
         if(contFlag){ //continue round once hit
@@ -441,39 +379,17 @@ void Display_Thread(void) {
         }
 
 
-        if( prevMalX != malletX || prevMalY != malletY){
-            // limit the magnitude values to the display range
-            float mag1Norm = ((float)mag1 / INT16_MAX) * 320;
-            float mag2Norm = ((float)mag2 / INT16_MAX) * 320;
-            // clear previous rectangle
-
-            for(int i =0; i<8; i++){ //draw mole holes
-                   G8RTOS_WaitSemaphore(&sem_SPIA);
-                   ST7789_DrawRectangle(moles[i].x, moles[i].y, 20, 10,ST7789_BROWN );
-                   G8RTOS_SignalSemaphore(&sem_SPIA);
-            }
-
-
-            // update previous value
-            prevMalX = malletX;
-            prevMalY = malletY;
-        }
-
-        for(int i =0; i<8; i++){ //draw mole
-            G8RTOS_WaitSemaphore(&sem_SPIA);
-            if(moles[i].isVisible){
-                ST7789_DrawRectangle(moles[i].x+3, moles[i].y+10, 14, 15,ST7789_MOLE );
-                ST7789_DrawRectangle(moles[i].x+3+3, moles[i].y+10+11,2,2, ST7789_BLACK);
-                ST7789_DrawRectangle(moles[i].x+3+9, moles[i].y+10+11, 2,2, ST7789_BLACK);
-            }
-            G8RTOS_SignalSemaphore(&sem_SPIA);
+        for(int i =0; i<8; i++){ //show or hide moles, only changes get resent
+            TileRenderer_SetVisible(moles[i].sprite, moles[i].isVisible);
           }
 
-
         moleTimer--;
         gameTime--;
 
-        sleep(20);
+        // paced by the display instead of a blind sleep, frame goes out at the slot
+        FramePacer_WaitFrame();
+        PerfOverlay_Frame();
+        DisplayServer_FlushTiles();
     }
 
 }
@@ -497,7 +413,7 @@ void Read_Buttons(void) {
         // clear button interrupt
         GPIOIntClear(BUTTONS_INT_GPIO_BASE,BUTTONS_INT_PIN);
         // update current_buttons value?????
-        G8RTOS_WriteFIFO(BUTTONS_FIFO, buttons);
+        G8RTOS_Publish(BUTTONS_TOPIC, buttons);
 
         G8RTOS_SignalSemaphore(&sem_PCA9555_Debounce);
 
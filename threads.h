@@ -14,10 +14,11 @@
 
 /*************************************Defines***************************************/
 
-#define BUTTONS_FIFO        0
 #define JOYSTICK_FIFO       1
 #define JOYSTICK_P_FIFO     2
 
+#define BUTTONS_TOPIC       0
+
 
 
 
@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+# sprite_convert.py
+# Date Created: 2026-10-19
+# Date Updated: 2026-10-19
+# Converts PNG/PPM images into run-length encoded palette sprites (Sprite_t)
+#
+# Usage:
+#   python3 tools/sprite_convert.py -o sprites assets/mole.png assets/mallet.png
+#
+# Writes sprites.c and sprites.h with one `const Sprite_t sprite_<name>`
+# per image, named after the file. Pixels with alpha below 128, or of the
+# --key color, become transparent. Only the Python standard library is
+# needed: 8-bit non-interlaced PNGs (gray, RGB, palette, with or without
+# alpha) and binary PPMs are read directly.
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAX_COLORS = 255          # index 255 is SPRITE_NO_KEY
+MAX_SIZE = 255            # Sprite_t.w and .h are uint8_t
+MAX_RUN = 255
+
+
+def read_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG file' % path)
+
+    pos = 8
+    idat = b''
+    palette = []
+    trns = b''
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'PLTE':
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b'tRNS':
+            trns = body
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+
+    if depth != 8 or interlace != 0:
+        raise ValueError('%s: only 8-bit non-interlaced PNGs are supported' % path)
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        ftype = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            left = line[i - channels] if i >= channels else 0
+            up = prev[i]
+            upleft = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = left + up - upleft
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - upleft)
+                pred = left if pa <= pb and pa <= pc else (up if pb <= pc else upleft)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = []
+    for line in rows:
+        out = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if ctype == 0:
+                out.append((px[0], px[0], px[0], 255))
+            elif ctype == 2:
+                out.append((px[0], px[1], px[2], 255))
+            elif ctype == 3:
+                alpha = trns[px[0]] if px[0] < len(trns) else 255
+                out.append(palette[px[0]] + (alpha,))
+            elif ctype == 4:
+                out.append((px[0], px[0], px[0], px[1]))
+            else:
+                out.append(tuple(px))
+        pixels.append(out)
+    return width, height, pixels
+
+
+def read_ppm(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(data[start:pos])
+    if fields[0] != b'P6' or int(fields[3]) != 255:
+        raise ValueError('%s: only binary 8-bit PPM (P6) is supported' % path)
+    width, height = int(fields[1]), int(fields[2])
+    pos += 1
+    pixels = []
+    for y in range(height):
+        row = []
+        for x in range(width):
+            i = pos + (y * width + x) * 3
+            row.append((data[i], data[i + 1], data[i + 2], 255))
+        pixels.append(row)
+    return width, height, pixels
+
+
+def to_panel565(r, g, b):
+    # The panel is wired BGR, see ST7789_RED = 0x001F
+    return ((b >> 3) << 11) | ((g >> 2) << 5) | (r >> 3)
+
+
+def encode(width, height, pixels, key):
+    if width > MAX_SIZE or height > MAX_SIZE:
+        raise ValueError('sprites are at most %dx%d' % (MAX_SIZE, MAX_SIZE))
+
+    palette = []
+    lookup = {}
+    transparent = None
+    rows = []
+    data = []
+
+    for line in pixels:
+        indices = []
+        for r, g, b, a in line:
+            if a < 128 or (key is not None and (r, g, b) == key):
+                if transparent is None:
+                    transparent = len(palette)
+                    palette.append(0x0000)
+                indices.append(transparent)
+                continue
+            color = to_panel565(r, g, b)
+            if color not in lookup:
+                lookup[color] = len(palette)
+                palette.append(color)
+            indices.append(lookup[color])
+        if len(palette) > MAX_COLORS:
+            raise ValueError('more than %d colors' % MAX_COLORS)
+
+        rows.append(len(data))
+        x = 0
+        while x < width:
+            run = 1
+            while x + run < width and run < MAX_RUN and indices[x + run] == indices[x]:
+                run += 1
+            data += [run, indices[x]]
+            x += run
+
+    return palette, transparent, rows, data
+
+
+def c_array(ctype, name, values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(fmt % v for v in values[i:i + per_line]) + ',')
+    return 'static const %s %s[%d] = {\n%s\n};\n' % (ctype, name, len(values), '\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert images to Sprite_t C sources.')
+    parser.add_argument('images', nargs='+', help='PNG or binary PPM files')
+    parser.add_argument('-o', '--output', required=True, help='output path without extension')
+    parser.add_argument('--key', help='RRGGBB color drawn as transparent')
+    parser.add_argument('--include', default='MiscFunctions/Graphics/inc/sprite.h',
+                        help='path of sprite.h as written in the #include')
+    args = parser.parse_args()
+
+    key = None
+    if args.key:
+        key = tuple(int(args.key[i:i + 2], 16) for i in (0, 2, 4))
+
+    base = os.path.basename(args.output)
+    guard = base.upper().replace('-', '_') + '_H_'
+    sources = ' '.join(os.path.relpath(p) for p in args.images)
+
+    header = ['// %s.h' % base,
+              '// Generated by tools/sprite_convert.py from %s, do not edit' % sources,
+              '',
+              '#ifndef %s' % guard,
+              '#define %s' % guard,
+              '',
+              '#include "%s"' % args.include,
+              '']
+    source = ['// %s.c' % base,
+              '// Generated by tools/sprite_convert.py from %s, do not edit' % sources,
+              '',
+              '#include "%s.h"' % base,
+              '']
+
+    total = 0
+    for path in args.images:
+        name = os.path.splitext(os.path.basename(path))[0].replace('-', '_')
+        if path.lower().endswith('.png'):
+            width, height, pixels = read_png(path)
+        else:
+            width, height, pixels = read_ppm(path)
+        palette, transparent, rows, data = encode(width, height, pixels, key)
+
+        source.append('// %s: %dx%d, %d colors, %d bytes of runs' % (name, width, height, len(palette), len(data)))
+        source.append(c_array('uint16_t', name + '_palette', palette, 8, '0x%04X'))
+        source.append(c_array('uint16_t', name + '_rows', rows, 12, '%d'))
+        source.append(c_array('uint8_t', name + '_data', data, 16, '%d'))
+        source.append('const Sprite_t sprite_%s = {' % name)
+        source.append('    .w = %d, .h = %d,' % (width, height))
+        source.append('    .key = %s, .colors = %d,' % ('SPRITE_NO_KEY' if transparent is None else transparent,
+                                                     len(palette)))
+        source.append('    .palette = %s_palette, .rows = %s_rows, .data = %s_data' % (name, name, name))
+        source.append('};')
+        source.append('')
+        header.append('extern const Sprite_t sprite_%s;' % name)
+        total += 2 * len(palette) + 2 * len(rows) + len(data)
+
+    header += ['', '#endif /* %s */' % guard, '']
+
+    with open(args.output + '.h', 'w') as f:
+        f.write('\n'.join(header))
+    with open(args.output + '.c', 'w') as f:
+        f.write('\n'.join(source))
+
+    print('%d sprites, %d bytes of flash' % (len(args.images), total), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
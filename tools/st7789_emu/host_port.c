@@ -0,0 +1,252 @@
+// host_port.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Host stand-ins for the SPI, GPIO, uDMA and semaphore calls the display
+// driver makes. Every frame the driver would clock out goes to the model.
+
+/************************************Includes***************************************/
+
+#include "./st7789_emu.h"
+
+#include "../../MultimodDrivers/multimod_spi.h"
+#include "../../MultimodDrivers/multimod_ST7789.h"
+#include "../../G8RTOS/G8RTOS_Semaphores.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <driverlib/gpio.h>
+#include <driverlib/sysctl.h>
+#include <driverlib/ssi.h>
+#include <driverlib/udma.h>
+
+/************************************Includes***************************************/
+
+/********************************Private Variables**********************************/
+
+// SSI0 frame size, the driver switches to 16 for RGB565 pixel data
+static uint8_t frameBits = 8;
+
+// Bits clocked out so far, the driver's bus timer runs off this
+static uint64_t bitsSent = 0;
+
+// uDMA SSI0 TX channel
+static uint32_t dmaControl;
+static const void *dmaSrc;
+static uint32_t dmaCount;
+static bool dmaRunning;
+static bool dmaQueued;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// Host_Frame
+// Clocks one SSI frame out MSB first.
+// Param uint16_t "value": frame, only the low frameBits bits are sent.
+// Return: void
+static void Host_Frame(uint16_t value) {
+    bitsSent += frameBits;
+    if (frameBits > 8) {
+        ST7789Emu_Write(value >> 8);
+    }
+    ST7789Emu_Write(value & 0xFF);
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// Host_Cycles
+// Gets the CPU cycles the bus has taken so far at HOST_SPI_HZ, used by
+// the driver in place of the DWT cycle counter.
+// Return: uint32_t
+uint32_t Host_Cycles(void) {
+    return (uint32_t)((bitsSent * SysCtlClockGet()) / HOST_SPI_HZ);
+}
+
+// SPI
+void SPI_Init(uint32_t mod) {
+    (void)mod;
+    frameBits = 8;
+}
+
+void SPI_WriteSingle(uint32_t mod, uint8_t byte) {
+    (void)mod;
+    Host_Frame(byte);
+}
+
+uint8_t SPI_ReadSingle(uint32_t mod) {
+    (void)mod;
+    Host_Frame(0x00);
+    return 0;
+}
+
+void SPI_WaitIdle(uint32_t mod) {
+    (void)mod;
+}
+
+void SPI_SetDataWidth(uint32_t mod, uint8_t bits) {
+    (void)mod;
+    frameBits = bits;
+}
+
+void SPI_WriteBurst(uint32_t mod, const uint8_t* data, uint32_t num_bytes) {
+    (void)mod;
+    while (num_bytes--) {
+        Host_Frame(*data++);
+    }
+}
+
+void SPI_WriteRepeat16(uint32_t mod, uint16_t value, uint32_t count) {
+    (void)mod;
+    while (count--) {
+        if (frameBits > 8) {
+            Host_Frame(value);
+        } else {
+            Host_Frame(value >> 8);
+            Host_Frame(value & 0xFF);
+        }
+    }
+}
+
+void SPI_WriteBurst16(uint32_t mod, const uint16_t* data, uint32_t count) {
+    (void)mod;
+    while (count--) {
+        if (frameBits > 8) {
+            Host_Frame(*data);
+        } else {
+            Host_Frame(*data >> 8);
+            Host_Frame(*data & 0xFF);
+        }
+        data++;
+    }
+}
+
+// GPIO, only the display CS and D/C pins matter
+void GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val) {
+    if (ui32Port != ST7789_PIN_PORT_BASE) {
+        return;
+    }
+
+    if (ui8Pins & ST7789_CS_PIN) {
+        ST7789Emu_Select(!(ui8Val & ST7789_CS_PIN));
+    }
+
+    if (ui8Pins & ST7789_DC_PIN) {
+        ST7789Emu_SetDC(ui8Val & ST7789_DC_PIN);
+    }
+}
+
+void GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins) {
+    (void)ui32Port;
+    (void)ui8Pins;
+}
+
+// SysCtl
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral) {
+    (void)ui32Peripheral;
+}
+
+bool SysCtlPeripheralReady(uint32_t ui32Peripheral) {
+    (void)ui32Peripheral;
+    return 1;
+}
+
+void SysCtlDelay(uint32_t ui32Count) {
+    (void)ui32Count;
+}
+
+uint32_t SysCtlClockGet(void) {
+    return 80000000;
+}
+
+// SSI and uDMA. Transfers finish as soon as they are enabled and the
+// completion interrupt runs right after, queueing the next chunk.
+void SSIDMAEnable(uint32_t ui32Base, uint32_t ui32DMAFlags) {
+    (void)ui32Base;
+    (void)ui32DMAFlags;
+}
+
+void SSIDMADisable(uint32_t ui32Base, uint32_t ui32DMAFlags) {
+    (void)ui32Base;
+    (void)ui32DMAFlags;
+}
+
+void uDMAEnable(void) {
+}
+
+void uDMAControlBaseSet(void *pControlTable) {
+    (void)pControlTable;
+}
+
+void uDMAChannelAssign(uint32_t ui32Mapping) {
+    (void)ui32Mapping;
+}
+
+void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr) {
+    (void)ui32ChannelNum;
+    (void)ui32Attr;
+}
+
+void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control) {
+    (void)ui32ChannelStructIndex;
+    dmaControl = ui32Control;
+}
+
+void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode, void *pvSrcAddr,
+                            void *pvDstAddr, uint32_t ui32TransferSize) {
+    (void)ui32ChannelStructIndex;
+    (void)ui32Mode;
+    (void)pvDstAddr;
+    dmaSrc = pvSrcAddr;
+    dmaCount = ui32TransferSize;
+}
+
+uint32_t uDMAChannelModeGet(uint32_t ui32ChannelStructIndex) {
+    (void)ui32ChannelStructIndex;
+    return UDMA_MODE_STOP;
+}
+
+void uDMAChannelEnable(uint32_t ui32ChannelNum) {
+    (void)ui32ChannelNum;
+    // The handler enables the next chunk itself, run those in this loop
+    dmaQueued = 1;
+    if (dmaRunning) {
+        return;
+    }
+
+    dmaRunning = 1;
+    while (dmaQueued) {
+        dmaQueued = 0;
+
+        bool wide = ((dmaControl >> 24) & 0x3) == 1;
+        bool increment = (dmaControl & UDMA_SRC_INC_NONE) != UDMA_SRC_INC_NONE;
+        for (uint32_t i = 0; i < dmaCount; i++) {
+            uint32_t index = increment ? i : 0;
+            Host_Frame(wide ? ((const uint16_t *)dmaSrc)[index] : ((const uint8_t *)dmaSrc)[index]);
+        }
+
+        ST7789_DMA_Handler();
+    }
+    dmaRunning = 0;
+}
+
+// G8RTOS semaphores, single threaded so a wait that would block is a bug
+void G8RTOS_InitSemaphore(semaphore_t* s, int32_t value) {
+    *s = value;
+}
+
+void G8RTOS_WaitSemaphore(semaphore_t* s) {
+    if (*s <= 0) {
+        fprintf(stderr, "host_port: wait on a semaphore nobody can signal\n");
+        exit(1);
+    }
+    (*s)--;
+}
+
+void G8RTOS_SignalSemaphore(semaphore_t* s) {
+    (*s)++;
+}
+
+/********************************Public Functions***********************************/
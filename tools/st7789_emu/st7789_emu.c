@@ -0,0 +1,530 @@
+// st7789_emu.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Host model of the ST7789 controller, decodes the SPI stream into frame memory
+
+/************************************Includes***************************************/
+
+#include "./st7789_emu.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define CMD_SWRESET         0x01
+#define CMD_SLPIN           0x10
+#define CMD_SLPOUT          0x11
+#define CMD_INVOFF          0x20
+#define CMD_INVON           0x21
+#define CMD_DISPOFF         0x28
+#define CMD_DISPON          0x29
+#define CMD_CASET           0x2A
+#define CMD_RASET           0x2B
+#define CMD_RAMWR           0x2C
+#define CMD_VSCRDEF         0x33
+#define CMD_MADCTL          0x36
+#define CMD_VSCRSADD        0x37
+#define CMD_COLMOD          0x3A
+#define CMD_RAMWRC          0x3C
+
+#define MADCTL_MY           0x80
+#define MADCTL_MX           0x40
+#define MADCTL_MV           0x20
+#define MADCTL_BGR          0x08
+
+// The IPS glass on the module inverts, so INVON shows memory colors as sent
+#define EMU_GLASS_INVERTED  1
+
+// The panel sits on the board turned half a turn from memory order, which
+// is why ST7789_Init mirrors columns and drawing y = 0 is the bottom row
+#define EMU_PANEL_ROTATED   1
+
+/*************************************Defines***************************************/
+
+/********************************Private Variables**********************************/
+
+// Frame memory as 0xAABBCC, one byte per color field in the order sent
+static uint32_t gram[EMU_GRAM_H][EMU_GRAM_W];
+
+static bool selected;
+static bool dataMode;
+
+static uint8_t command;
+static uint8_t params[EMU_MAX_PARAMS];
+static uint8_t numParams;
+static bool pixelWrite;
+
+static uint8_t madctl;
+static uint8_t colmod;
+static bool inverted;
+static bool displayOn;
+static bool sleeping;
+
+// Window and address counter, in MADCTL (drawing) coordinates
+static uint16_t colStart, colEnd, rowStart, rowEnd;
+static uint16_t col, row;
+
+// Bytes of a pixel (or 12-bit pixel pair) still being assembled
+static uint8_t pixelBuf[3];
+static uint8_t pixelLen;
+
+// Vertical scrolling, in memory rows
+static uint16_t scrollTop, scrollHeight, scrollStart;
+
+static ST7789EmuStats_t total;
+static ST7789EmuStats_t mark;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// ST7789Emu_Expand
+// Scales a color field to 8 bits.
+// Param uint32_t "value": field value.
+// Param uint8_t "bits": field width.
+// Return: uint32_t
+static uint32_t ST7789Emu_Expand(uint32_t value, uint8_t bits) {
+    return (value << (8 - bits)) | (value >> (2 * bits - 8));
+}
+
+// ST7789Emu_Store
+// Writes one pixel at the address counter and advances it like the
+// controller does, wrapping inside the window.
+// Param uint32_t "color": 0xAABBCC fields in the order they were sent.
+// Return: void
+static void ST7789Emu_Store(uint32_t color) {
+    uint16_t c = col;
+    uint16_t r = row;
+    uint16_t colLimit = (madctl & MADCTL_MV) ? EMU_GRAM_H : EMU_GRAM_W;
+    uint16_t rowLimit = (madctl & MADCTL_MV) ? EMU_GRAM_W : EMU_GRAM_H;
+
+    if (c < colLimit && r < rowLimit) {
+        if (madctl & MADCTL_MX) {
+            c = colLimit - 1 - c;
+        }
+        if (madctl & MADCTL_MY) {
+            r = rowLimit - 1 - r;
+        }
+        if (madctl & MADCTL_MV) {
+            uint16_t t = c;
+            c = r;
+            r = t;
+        }
+        gram[r][c] = color;
+    }
+
+    total.pixels++;
+
+    if (col < colEnd) {
+        col++;
+    } else {
+        col = colStart;
+        row = (row < rowEnd) ? row + 1 : rowStart;
+    }
+}
+
+// ST7789Emu_Store444
+// Stores one RGB444 pixel.
+// Param uint32_t "value": 12-bit pixel.
+// Return: void
+static void ST7789Emu_Store444(uint32_t value) {
+    ST7789Emu_Store((ST7789Emu_Expand(value >> 8, 4) << 16) | (ST7789Emu_Expand((value >> 4) & 0xF, 4) << 8) |
+                    ST7789Emu_Expand(value & 0xF, 4));
+}
+
+// ST7789Emu_Pixel
+// Collects a pixel data byte and stores pixels once complete.
+// Param uint8_t "byte": data byte.
+// Return: void
+static void ST7789Emu_Pixel(uint8_t byte) {
+    total.pixelBytes++;
+    pixelBuf[pixelLen++] = byte;
+
+    switch (colmod & 0x07) {
+    case 0x03: // 12 bit, two pixels in three bytes
+        // Each pixel lands as soon as its 12 bits are in, so a window that
+        // ends on an odd pixel still gets it
+        if (pixelLen == 2) {
+            ST7789Emu_Store444((pixelBuf[0] << 4) | (pixelBuf[1] >> 4));
+        } else if (pixelLen == 3) {
+            ST7789Emu_Store444(((pixelBuf[1] & 0x0F) << 8) | pixelBuf[2]);
+            pixelLen = 0;
+        }
+        break;
+
+    case 0x05: // 16 bit
+        if (pixelLen == 2) {
+            uint32_t v = (pixelBuf[0] << 8) | pixelBuf[1];
+            ST7789Emu_Store((ST7789Emu_Expand(v >> 11, 5) << 16) | (ST7789Emu_Expand((v >> 5) & 0x3F, 6) << 8) |
+                            ST7789Emu_Expand(v & 0x1F, 5));
+            pixelLen = 0;
+        }
+        break;
+
+    default: // 18 bit, one byte per field
+        if (pixelLen == 3) {
+            ST7789Emu_Store((ST7789Emu_Expand(pixelBuf[0] >> 2, 6) << 16) |
+                            (ST7789Emu_Expand(pixelBuf[1] >> 2, 6) << 8) |
+                            ST7789Emu_Expand(pixelBuf[2] >> 2, 6));
+            pixelLen = 0;
+        }
+        break;
+    }
+}
+
+// ST7789Emu_Param
+// Collects a parameter byte and applies the command once it has all
+// the parameters it needs.
+// Param uint8_t "byte": data byte.
+// Return: void
+static void ST7789Emu_Param(uint8_t byte) {
+    total.paramBytes++;
+    if (numParams < EMU_MAX_PARAMS) {
+        params[numParams++] = byte;
+    }
+
+    switch (command) {
+    case CMD_CASET:
+        if (numParams == 4) {
+            colStart = (params[0] << 8) | params[1];
+            colEnd = (params[2] << 8) | params[3];
+        }
+        break;
+
+    case CMD_RASET:
+        if (numParams == 4) {
+            rowStart = (params[0] << 8) | params[1];
+            rowEnd = (params[2] << 8) | params[3];
+        }
+        break;
+
+    case CMD_MADCTL:
+        madctl = params[0];
+        break;
+
+    case CMD_COLMOD:
+        colmod = params[0];
+        break;
+
+    case CMD_VSCRDEF:
+        if (numParams == 6) {
+            scrollTop = (params[0] << 8) | params[1];
+            scrollHeight = (params[2] << 8) | params[3];
+        }
+        break;
+
+    case CMD_VSCRSADD:
+        if (numParams == 2) {
+            scrollStart = (params[0] << 8) | params[1];
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+// ST7789Emu_Command
+// Starts a command.
+// Param uint8_t "byte": command byte.
+// Return: void
+static void ST7789Emu_Command(uint8_t byte) {
+    total.commands++;
+    command = byte;
+    numParams = 0;
+    pixelWrite = 0;
+
+    switch (byte) {
+    case CMD_SWRESET:
+        madctl = 0;
+        colmod = 0x66;
+        inverted = 0;
+        displayOn = 0;
+        sleeping = 1;
+        colStart = rowStart = 0;
+        colEnd = EMU_GRAM_W - 1;
+        rowEnd = EMU_GRAM_H - 1;
+        scrollTop = 0;
+        scrollHeight = EMU_GRAM_H;
+        scrollStart = 0;
+        break;
+
+    case CMD_SLPIN:   sleeping = 1;  break;
+    case CMD_SLPOUT:  sleeping = 0;  break;
+    case CMD_INVOFF:  inverted = 0;  break;
+    case CMD_INVON:   inverted = 1;  break;
+    case CMD_DISPOFF: displayOn = 0; break;
+    case CMD_DISPON:  displayOn = 1; break;
+
+    case CMD_RAMWR:
+        col = colStart;
+        row = rowStart;
+        /* fall through */
+    case CMD_RAMWRC:
+        pixelWrite = 1;
+        pixelLen = 0;
+        total.windows += (byte == CMD_RAMWR);
+        break;
+
+    default:
+        break;
+    }
+}
+
+// ST7789Emu_ScanRow
+// Gets the memory row shown on a panel line, following vertical scrolling.
+// Param uint16_t "line": memory row the panel would show without scrolling.
+// Return: uint16_t
+static uint16_t ST7789Emu_ScanRow(uint16_t line) {
+    if (scrollHeight == 0 || line < scrollTop || line >= scrollTop + scrollHeight) {
+        return line;
+    }
+
+    return scrollTop + (line - scrollTop + scrollStart - scrollTop + scrollHeight) % scrollHeight;
+}
+
+// ST7789Emu_PutU32
+// Writes a big-endian 32-bit value.
+// Return: void
+static void ST7789Emu_PutU32(uint8_t *out, uint32_t value) {
+    out[0] = value >> 24;
+    out[1] = value >> 16;
+    out[2] = value >> 8;
+    out[3] = value;
+}
+
+// ST7789Emu_Chunk
+// Writes one PNG chunk.
+// Param FILE* "file": output.
+// Param char* "type": four character chunk type.
+// Param uint8_t* "data": chunk data.
+// Param uint32_t "len": length of data.
+// Return: void
+static void ST7789Emu_Chunk(FILE *file, const char *type, const uint8_t *data, uint32_t len) {
+    static uint32_t table[256];
+    if (table[1] == 0) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
+        }
+    }
+
+    uint8_t word[4];
+    ST7789Emu_PutU32(word, len);
+    fwrite(word, 1, 4, file);
+    fwrite(type, 1, 4, file);
+    fwrite(data, 1, len, file);
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < 4; i++) {
+        crc = table[(crc ^ (uint8_t)type[i]) & 0xFF] ^ (crc >> 8);
+    }
+    for (uint32_t i = 0; i < len; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    ST7789Emu_PutU32(word, crc ^ 0xFFFFFFFF);
+    fwrite(word, 1, 4, file);
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// ST7789Emu_Reset
+// Puts the model in its power-on state and clears frame memory and counters.
+// Return: void
+void ST7789Emu_Reset(void) {
+    memset(gram, 0, sizeof(gram));
+    memset(&total, 0, sizeof(total));
+    memset(&mark, 0, sizeof(mark));
+
+    selected = 0;
+    dataMode = 0;
+    ST7789Emu_Command(CMD_SWRESET);
+    command = 0;
+    total.commands = 0;
+}
+
+// ST7789Emu_Select
+// Drives CS. Deselecting drops a partly received pixel, like the chip.
+// Param bool "sel": true while CS is low.
+// Return: void
+void ST7789Emu_Select(bool sel) {
+    if (sel && !selected) {
+        total.selects++;
+    }
+    if (!sel) {
+        pixelLen = 0;
+    }
+    selected = sel;
+}
+
+// ST7789Emu_SetDC
+// Drives the D/C pin.
+// Param bool "data": true for data, false for command.
+// Return: void
+void ST7789Emu_SetDC(bool data) {
+    dataMode = data;
+}
+
+// ST7789Emu_Write
+// Clocks one byte in, ignored unless CS is low.
+// Param uint8_t "byte": byte on the bus.
+// Return: void
+void ST7789Emu_Write(uint8_t byte) {
+    if (!selected) {
+        return;
+    }
+
+    if (!dataMode) {
+        ST7789Emu_Command(byte);
+    } else if (pixelWrite) {
+        ST7789Emu_Pixel(byte);
+    } else {
+        ST7789Emu_Param(byte);
+    }
+}
+
+// ST7789Emu_GetPixel
+// Gets a pixel as it shows on the panel, with MADCTL color order,
+// inversion and scrolling applied.
+// Param uint16_t "x", "y": panel pixel, 0, 0 is the top left as mounted.
+// Return: uint32_t, 0xRRGGBB
+uint32_t ST7789Emu_GetPixel(uint16_t x, uint16_t y) {
+    if (x >= EMU_PANEL_W || y >= EMU_PANEL_H || !displayOn || sleeping) {
+        return 0;
+    }
+
+    if (EMU_PANEL_ROTATED) {
+        x = EMU_PANEL_W - 1 - x;
+        y = EMU_PANEL_H - 1 - y;
+    }
+
+    uint32_t c = gram[ST7789Emu_ScanRow(y + EMU_PANEL_ROW0)][x];
+
+    if (madctl & MADCTL_BGR) {
+        c = ((c & 0xFF) << 16) | (c & 0xFF00) | ((c >> 16) & 0xFF);
+    }
+
+    if (inverted != EMU_GLASS_INVERTED) {
+        c ^= 0xFFFFFF;
+    }
+
+    return c;
+}
+
+// ST7789Emu_GetStats
+// Gets the counters since the last reset.
+// Param ST7789EmuStats_t* "stats": output.
+// Return: void
+void ST7789Emu_GetStats(ST7789EmuStats_t *stats) {
+    *stats = total;
+}
+
+// ST7789Emu_EndFrame
+// Gets the counters since the previous EndFrame and starts a new frame.
+// Param ST7789EmuStats_t* "frame": output.
+// Return: void
+void ST7789Emu_EndFrame(ST7789EmuStats_t *frame) {
+    frame->commands = total.commands - mark.commands;
+    frame->paramBytes = total.paramBytes - mark.paramBytes;
+    frame->pixelBytes = total.pixelBytes - mark.pixelBytes;
+    frame->pixels = total.pixels - mark.pixels;
+    frame->windows = total.windows - mark.windows;
+    frame->selects = total.selects - mark.selects;
+    mark = total;
+}
+
+// ST7789Emu_WritePPM
+// Dumps the panel as a binary PPM.
+// Param char* "path": output file.
+// Return: int32_t, 0 or -1 if the file could not be written.
+int32_t ST7789Emu_WritePPM(const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return -1;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", EMU_PANEL_W, EMU_PANEL_H);
+    for (uint16_t y = 0; y < EMU_PANEL_H; y++) {
+        for (uint16_t x = 0; x < EMU_PANEL_W; x++) {
+            uint32_t c = ST7789Emu_GetPixel(x, y);
+            uint8_t rgb[3] = { c >> 16, c >> 8, c };
+            fwrite(rgb, 1, 3, file);
+        }
+    }
+
+    return fclose(file) ? -1 : 0;
+}
+
+// ST7789Emu_WritePNG
+// Dumps the panel as an RGB PNG. The image data goes in stored (not
+// compressed) deflate blocks so no zlib is needed.
+// Param char* "path": output file.
+// Return: int32_t, 0 or -1 if the file could not be written.
+int32_t ST7789Emu_WritePNG(const char *path) {
+    enum { STRIDE = 1 + 3 * EMU_PANEL_W, RAW = STRIDE * EMU_PANEL_H };
+    // zlib header, one 5 byte header per stored block of up to 65535 bytes, adler32
+    static uint8_t idat[2 + RAW + 5 * (RAW / 65535 + 1) + 4];
+    static uint8_t raw[RAW];
+
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return -1;
+    }
+
+    for (uint16_t y = 0; y < EMU_PANEL_H; y++) {
+        uint8_t *line = &raw[y * STRIDE];
+        line[0] = 0;
+        for (uint16_t x = 0; x < EMU_PANEL_W; x++) {
+            uint32_t c = ST7789Emu_GetPixel(x, y);
+            line[1 + 3 * x] = c >> 16;
+            line[2 + 3 * x] = c >> 8;
+            line[3 + 3 * x] = c;
+        }
+    }
+
+    uint32_t n = 0;
+    idat[n++] = 0x78;
+    idat[n++] = 0x01;
+    for (uint32_t pos = 0; pos < RAW; ) {
+        uint32_t len = (RAW - pos > 65535) ? 65535 : RAW - pos;
+        idat[n++] = (pos + len == RAW);
+        idat[n++] = len & 0xFF;
+        idat[n++] = len >> 8;
+        idat[n++] = ~len & 0xFF;
+        idat[n++] = (~len >> 8) & 0xFF;
+        memcpy(&idat[n], &raw[pos], len);
+        n += len;
+        pos += len;
+    }
+
+    uint32_t a = 1, b = 0;
+    for (uint32_t i = 0; i < RAW; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    ST7789Emu_PutU32(&idat[n], (b << 16) | a);
+    n += 4;
+
+    uint8_t ihdr[13] = { 0 };
+    ST7789Emu_PutU32(&ihdr[0], EMU_PANEL_W);
+    ST7789Emu_PutU32(&ihdr[4], EMU_PANEL_H);
+    ihdr[8] = 8;    // bit depth
+    ihdr[9] = 2;    // RGB
+
+    fwrite("\x89PNG\r\n\x1a\n", 1, 8, file);
+    ST7789Emu_Chunk(file, "IHDR", ihdr, sizeof(ihdr));
+    ST7789Emu_Chunk(file, "IDAT", idat, n);
+    ST7789Emu_Chunk(file, "IEND", 0, 0);
+
+    return fclose(file) ? -1 : 0;
+}
+
+/********************************Public Functions***********************************/
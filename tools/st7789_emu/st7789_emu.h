@@ -0,0 +1,63 @@
+// st7789_emu.h
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Host model of the ST7789 controller, decodes the SPI stream into frame memory
+
+#ifndef ST7789_EMU_H_
+#define ST7789_EMU_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Frame memory of the controller, the 240x280 panel shows rows 20..299
+#define EMU_GRAM_W          240
+#define EMU_GRAM_H          320
+#define EMU_PANEL_W         240
+#define EMU_PANEL_H         280
+#define EMU_PANEL_ROW0      20
+
+#define EMU_MAX_PARAMS      16
+
+// SSI0 clock set in SPI_Init
+#define HOST_SPI_HZ         15000000
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Bus traffic, counted the way it appears on the wire
+typedef struct ST7789EmuStats_t {
+    uint32_t commands;          // bytes sent with D/C low
+    uint32_t paramBytes;        // data bytes that are not pixels
+    uint32_t pixelBytes;        // data bytes after RAMWR / RAMWRC
+    uint32_t pixels;            // pixels written to frame memory
+    uint32_t windows;           // RAMWR commands, each starts a window
+    uint32_t selects;           // CS falling edges
+} ST7789EmuStats_t;
+
+/******************************Data Type Definitions********************************/
+
+/********************************Public Functions***********************************/
+
+void ST7789Emu_Reset(void);
+
+void ST7789Emu_Select(bool selected);
+void ST7789Emu_SetDC(bool data);
+void ST7789Emu_Write(uint8_t byte);
+
+uint32_t ST7789Emu_GetPixel(uint16_t x, uint16_t y);
+void ST7789Emu_GetStats(ST7789EmuStats_t *stats);
+void ST7789Emu_EndFrame(ST7789EmuStats_t *frame);
+
+int32_t ST7789Emu_WritePPM(const char *path);
+int32_t ST7789Emu_WritePNG(const char *path);
+
+/********************************Public Functions***********************************/
+
+#endif /* ST7789_EMU_H_ */
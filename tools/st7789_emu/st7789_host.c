@@ -0,0 +1,492 @@
+// st7789_host.c
+// Date Created: 2026-10-19
+// Date Updated: 2026-10-19
+// Runs the display driver, GFX library and tile renderer on the host
+// against the ST7789 model, dumps every frame and prints its bus traffic.
+// Paths that should draw the same picture are compared against each other
+// and the program exits non-zero if any of them differ.
+//
+// Usage: ./st7789_host [-o dir] [-ppm]
+// Frames go to dir (default frames/) as PNG, or PPM with -ppm.
+
+/************************************Includes***************************************/
+
+#include "./st7789_emu.h"
+
+#include "../../MultimodDrivers/multimod_ST7789.h"
+#include "../../MultimodDrivers/GFX_Library.h"
+#include "../../MiscFunctions/Graphics/inc/tile_renderer.h"
+#include "../../sprites.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <driverlib/sysctl.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Largest per-channel difference between an RGB565 pixel and its RGB444
+// copy, one 4-bit step
+#define HOST_TOLERANCE_444  17
+
+// Moves, hides and random queries for the collision grid check
+#define HOST_QUERY_ROUNDS   500
+#define HOST_QUERY_PER_ROUND 20
+
+/*************************************Defines***************************************/
+
+/********************************Private Variables**********************************/
+
+static const char *outDir = "frames";
+static bool writePPM = 0;
+static uint32_t frameNumber = 0;
+static ST7789Stats_t driverLast;
+
+// Panel captured by Host_Capture for the next Host_Compare
+static uint32_t reference[EMU_PANEL_H][EMU_PANEL_W];
+static uint32_t failures = 0;
+
+// Fills for the DMA check: full screen, odd pixel counts, counts that
+// are not a multiple of the 12-bit pattern, and rectangles hanging off
+// the screen
+static const struct {
+    int16_t x, y, w, h;
+    uint16_t color;
+} fillCases[] = {
+    { 0, 0, X_MAX, Y_MAX, ST7789_BLUE },    { 10, 10, 37, 13, ST7789_RED },
+    { 5, 40, 231, 9, ST7789_GREEN },        { 60, 100, 1, 1, ST7789_WHITE },
+    { -20, 150, 70, 33, ST7789_YELLOW },    { 200, 250, 60, 50, ST7789_ORANGE },
+};
+
+// Blits for the DMA check, one under and one over a uDMA transfer
+static const struct {
+    int16_t x, y, w, h;
+} blitCases[] = {
+    { 100, 60, 33, 31 }, { 150, 180, 40, 40 },
+};
+
+static uint16_t blitPixels[40 * 40];
+
+// Sprites over a rectangle and across every screen edge
+static const struct {
+    const Sprite_t *sprite;
+    int16_t x, y;
+} spriteCases[] = {
+    { &sprite_mole, -5, 50 },           { &sprite_mole, X_MAX - 6, 80 },
+    { &sprite_mole, 30, Y_MAX - 7 },    { &sprite_mallet, 60, -8 },
+    { &sprite_mole, 105, 110 },         { &sprite_mallet_hit, 120, 95 },
+    { &sprite_mallet, -3, Y_MAX - 12 },
+};
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// Host_EndFrame
+// Dumps the panel and prints the traffic since the previous frame. The
+// driver's own byte count and bus time are printed next to what was
+// decoded from the bus as a cross-check.
+// Param char* "name": frame name.
+// Return: void
+static void Host_EndFrame(const char *name) {
+    ST7789EmuStats_t frame;
+    ST7789Emu_EndFrame(&frame);
+
+    ST7789Stats_t driver;
+    ST7789_GetStats(&driver);
+    uint32_t driverBytes = (driver.commandBytes + driver.pixelBytes) -
+                           (driverLast.commandBytes + driverLast.pixelBytes);
+    uint32_t driverCycles = driver.busyCycles - driverLast.busyCycles;
+    driverLast = driver;
+
+    uint32_t total = frame.commands + frame.paramBytes + frame.pixelBytes;
+    printf("%-14s %7lu %7lu %7lu %8lu %8lu %8lu %8.2f %8.2f\n", name,
+           (unsigned long)frame.windows, (unsigned long)frame.commands, (unsigned long)frame.paramBytes,
+           (unsigned long)frame.pixelBytes, (unsigned long)total, (unsigned long)driverBytes,
+           total * 8.0 * 1000.0 / HOST_SPI_HZ, driverCycles * 1000.0 / SysCtlClockGet());
+
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%02lu_%s.%s", outDir, (unsigned long)frameNumber++, name,
+             writePPM ? "ppm" : "png");
+    if ((writePPM ? ST7789Emu_WritePPM(path) : ST7789Emu_WritePNG(path)) < 0) {
+        fprintf(stderr, "could not write %s\n", path);
+    }
+}
+
+// Host_Capture
+// Saves the panel as the reference for Host_Compare.
+// Return: void
+static void Host_Capture(void) {
+    for (uint16_t y = 0; y < EMU_PANEL_H; y++) {
+        for (uint16_t x = 0; x < EMU_PANEL_W; x++) {
+            reference[y][x] = ST7789Emu_GetPixel(x, y);
+        }
+    }
+}
+
+// Host_Compare
+// Compares the panel against the captured reference and counts a failure
+// if any pixel is off by more than the tolerance in a channel.
+// Param char* "name": check name.
+// Param uint8_t "tolerance": largest difference allowed per channel.
+// Return: uint32_t, pixels that differ
+static uint32_t Host_Compare(const char *name, uint8_t tolerance) {
+    uint32_t differ = 0;
+    for (uint16_t y = 0; y < EMU_PANEL_H; y++) {
+        for (uint16_t x = 0; x < EMU_PANEL_W; x++) {
+            uint32_t a = ST7789Emu_GetPixel(x, y);
+            uint32_t b = reference[y][x];
+            for (uint8_t shift = 0; shift < 24; shift += 8) {
+                int32_t d = (int32_t)((a >> shift) & 0xFF) - (int32_t)((b >> shift) & 0xFF);
+                if (d > tolerance || -d > tolerance) {
+                    if (!differ) {
+                        fprintf(stderr, "%s: first difference at %u,%u: %06lx vs %06lx\n", name, x, y,
+                                (unsigned long)a, (unsigned long)b);
+                    }
+                    differ++;
+                    break;
+                }
+            }
+        }
+    }
+
+    printf("check %-28s %s (%lu pixels differ)\n", name, differ ? "FAIL" : "ok", (unsigned long)differ);
+    if (differ) {
+        failures++;
+    }
+    return differ;
+}
+
+// Host_Scene
+// Draws a scene with each kind of GFX primitive.
+// Return: void
+static void Host_Scene(void) {
+    display_fillGradient(0, 0, 64, 0, 64, 128);
+    display_fillCircle(60, 60, 40, ST7789_RED);
+    display_fillRoundRect(120, 30, 100, 60, 12, ST7789_GREEN);
+    display_fillTriangle(20, 200, 120, 260, 60, 130, ST7789_BLUE);
+    display_drawCircle(180, 200, 40, ST7789_WHITE);
+    display_drawLine(0, 0, X_MAX - 1, Y_MAX - 1, ST7789_YELLOW);
+    display_drawString(130, 130, "ST7789", 6, ST7789_WHITE, ST7789_BLACK, 2);
+}
+
+// Host_OddRuns
+// Fills windows with several pushes of odd length and a lone pixel, the
+// cases where 12-bit pixel pairs straddle calls.
+// Return: void
+static void Host_OddRuns(void) {
+    static const uint16_t pixels[] = { ST7789_WHITE, ST7789_YELLOW, ST7789_ORANGE };
+
+    ST7789_BeginWindow(10, 10, 7, 2);
+    ST7789_WriteColor(ST7789_RED, 1);
+    ST7789_WriteColor(ST7789_GREEN, 2);
+    ST7789_WriteColor(ST7789_BLUE, 3);
+    ST7789_WritePixels(pixels, 3);
+    ST7789_WriteColor(ST7789_BROWN, 5);
+    ST7789_EndWindow();
+
+    ST7789_BeginWindow(30, 10, 1, 1);
+    ST7789_WriteColor(ST7789_WHITE, 1);
+    ST7789_EndWindow();
+
+    ST7789_BeginWindow(40, 10, 3, 3);
+    for (uint8_t i = 0; i < 9; i++) {
+        ST7789_WritePixels(&pixels[i % 3], 1);
+    }
+    ST7789_EndWindow();
+
+    ST7789_DrawRectangle(50, 10, 5, 3, ST7789_GREEN);
+}
+
+// Host_DMAScene
+// Draws fillCases and blitCases through the blocking calls or the uDMA.
+// Param bool "dma": 1 to use ST7789_DMA_FillRectangle and ST7789_DMA_Blit.
+// Return: void
+static void Host_DMAScene(bool dma) {
+    for (uint32_t i = 0; i < sizeof(fillCases) / sizeof(fillCases[0]); i++) {
+        if (dma) {
+            ST7789_DMA_FillRectangle(fillCases[i].x, fillCases[i].y, fillCases[i].w, fillCases[i].h,
+                                     fillCases[i].color);
+        } else {
+            ST7789_DrawRectangle(fillCases[i].x, fillCases[i].y, fillCases[i].w, fillCases[i].h,
+                                 fillCases[i].color);
+        }
+    }
+
+    for (uint32_t i = 0; i < sizeof(blitCases) / sizeof(blitCases[0]); i++) {
+        int16_t x = blitCases[i].x, y = blitCases[i].y, w = blitCases[i].w, h = blitCases[i].h;
+        if (dma) {
+            ST7789_DMA_Blit(x, y, w, h, blitPixels);
+        } else {
+            ST7789_BeginWindow(x, y, w, h);
+            ST7789_WritePixels(blitPixels, (uint32_t)w * h);
+            ST7789_EndWindow();
+        }
+    }
+}
+
+// Host_DMACheck
+// Draws the DMA scene both ways in one interface format and requires the
+// frames to match exactly.
+// Param uint8_t "bits": ST7789_COLOR_16BIT or ST7789_COLOR_12BIT.
+// Return: void
+static void Host_DMACheck(uint8_t bits) {
+    char name[32];
+
+    for (uint32_t i = 0; i < sizeof(blitPixels) / sizeof(blitPixels[0]); i++) {
+        blitPixels[i] = (uint16_t)(i * 0x0841 + (i >> 3) * 0x1F);
+    }
+
+    ST7789_SetColorDepth(bits);
+
+    Host_DMAScene(0);
+    Host_Capture();
+    snprintf(name, sizeof(name), "blocking%u", bits);
+    Host_EndFrame(name);
+
+    ST7789_Fill(ST7789_BLACK);
+    Host_EndFrame("clear");
+
+    Host_DMAScene(1);
+    snprintf(name, sizeof(name), "dma%u vs blocking", bits);
+    Host_Compare(name, 0);
+    snprintf(name, sizeof(name), "dma%u", bits);
+    Host_EndFrame(name);
+
+    ST7789_SetColorDepth(ST7789_COLOR_16BIT);
+}
+
+// Host_RandomRect
+// Picks a rectangle that may hang off any edge of the screen.
+// Param int16_t* "x", "y", "w", "h": rectangle, returned.
+// Param int16_t "minSize": smallest width and height.
+// Return: void
+static void Host_RandomRect(int16_t *x, int16_t *y, int16_t *w, int16_t *h, int16_t minSize) {
+    *x = rand() % (X_MAX + 60) - 40;
+    *y = rand() % (Y_MAX + 60) - 40;
+    *w = minSize + rand() % (90 - minSize);
+    *h = minSize + rand() % (90 - minSize);
+}
+
+// Host_Overlaps
+// Tells if two rectangles share a pixel that is also on screen.
+// Param int16_t "ax".."ah", "bx".."bh": rectangles.
+// Return: bool
+static bool Host_Overlaps(int16_t ax, int16_t ay, int16_t aw, int16_t ah, int16_t bx, int16_t by, int16_t bw,
+                          int16_t bh) {
+    int32_t x0 = ax > bx ? ax : bx;
+    int32_t y0 = ay > by ? ay : by;
+    int32_t x1 = (ax + aw < bx + bw) ? ax + aw : bx + bw;
+    int32_t y1 = (ay + ah < by + bh) ? ay + ah : by + bh;
+
+    x0 = x0 > 0 ? x0 : 0;
+    y0 = y0 > 0 ? y0 : 0;
+    x1 = x1 < X_MAX ? x1 : X_MAX;
+    y1 = y1 < Y_MAX ? y1 : Y_MAX;
+
+    return x0 < x1 && y0 < y1;
+}
+
+// Host_QueryCheck
+// Moves and hides random rectangles in the tile renderer and checks every
+// Query and Collide result against a scan of the whole list.
+// Return: void
+static void Host_QueryCheck(void) {
+    struct {
+        int16_t x, y, w, h;
+        bool visible;
+    } list[TILE_MAX_ITEMS];
+    int32_t hits[TILE_MAX_ITEMS], expected[TILE_MAX_ITEMS];
+    uint32_t queries = 0, differ = 0;
+
+    srand(1);
+    TileRenderer_Init(background);
+    for (int32_t i = 0; i < TILE_MAX_ITEMS; i++) {
+        Host_RandomRect(&list[i].x, &list[i].y, &list[i].w, &list[i].h, 1);
+        list[i].visible = 1;
+        TileRenderer_AddRect(list[i].x, list[i].y, list[i].w, list[i].h, ST7789_BLUE);
+    }
+
+    for (uint32_t round = 0; round < HOST_QUERY_ROUNDS; round++) {
+        int32_t moved = rand() % TILE_MAX_ITEMS;
+        Host_RandomRect(&list[moved].x, &list[moved].y, &list[moved].w, &list[moved].h, 1);
+        TileRenderer_SetRect(moved, list[moved].x, list[moved].y, list[moved].w, list[moved].h);
+
+        int32_t toggled = rand() % TILE_MAX_ITEMS;
+        list[toggled].visible = !list[toggled].visible;
+        TileRenderer_SetVisible(toggled, list[toggled].visible);
+
+        // Random rectangles, then each item's own bounds through Collide
+        for (int32_t q = 0; q < HOST_QUERY_PER_ROUND + TILE_MAX_ITEMS; q++) {
+            int16_t x, y, w, h;
+            int32_t skip = -1;
+            uint32_t found;
+
+            if (q < HOST_QUERY_PER_ROUND) {
+                Host_RandomRect(&x, &y, &w, &h, 0);
+                found = TileRenderer_Query(x, y, w, h, hits, TILE_MAX_ITEMS);
+            } else {
+                skip = q - HOST_QUERY_PER_ROUND;
+                x = list[skip].x, y = list[skip].y, w = list[skip].w, h = list[skip].h;
+                found = TileRenderer_Collide(skip, hits, TILE_MAX_ITEMS);
+            }
+
+            // Topmost first, the same order Query reports
+            uint32_t count = 0;
+            for (int32_t i = TILE_MAX_ITEMS - 1; i >= 0; i--) {
+                if (i != skip && list[i].visible &&
+                    Host_Overlaps(x, y, w, h, list[i].x, list[i].y, list[i].w, list[i].h)) {
+                    expected[count++] = i;
+                }
+            }
+
+            queries++;
+            if (found != count || memcmp(hits, expected, count * sizeof(hits[0]))) {
+                if (!differ) {
+                    fprintf(stderr, "query %d,%d %dx%d: %lu hits, expected %lu\n", x, y, w, h,
+                            (unsigned long)found, (unsigned long)count);
+                }
+                differ++;
+            }
+        }
+    }
+
+    printf("check %-28s %s (%lu of %lu queries differ)\n", "query vs scan", differ ? "FAIL" : "ok",
+           (unsigned long)differ, (unsigned long)queries);
+    if (differ) {
+        failures++;
+    }
+}
+
+// Host_Sprites
+// Draws spriteCases with Sprite_Draw, or through the tile renderer which
+// decodes them with Sprite_ComposeRow.
+// Param bool "tiles": 1 for the tile renderer.
+// Return: void
+static void Host_Sprites(bool tiles) {
+    uint32_t count = sizeof(spriteCases) / sizeof(spriteCases[0]);
+
+    if (tiles) {
+        TileRenderer_Init(background);
+        TileRenderer_AddRect(100, 100, 40, 40, ST7789_BLUE);
+        for (uint32_t i = 0; i < count; i++) {
+            TileRenderer_AddSprite(spriteCases[i].x, spriteCases[i].y, spriteCases[i].sprite);
+        }
+        TileRenderer_InvalidateAll();
+        TileRenderer_Flush();
+    } else {
+        ST7789_Fill(background);
+        ST7789_DrawRectangle(100, 100, 40, 40, ST7789_BLUE);
+        for (uint32_t i = 0; i < count; i++) {
+            Sprite_Draw(spriteCases[i].sprite, spriteCases[i].x, spriteCases[i].y);
+        }
+    }
+}
+
+// Host_GameImmediate
+// Draws the game screen of the tile frames straight to the display, the
+// way the game drew before the tile renderer.
+// Param Sprite_t* "mallet": mallet sprite.
+// Param int16_t "x", "y": mallet position.
+// Return: void
+static void Host_GameImmediate(const Sprite_t *mallet, int16_t x, int16_t y) {
+    ST7789_Fill(background);
+    for (int i = 0; i < 8; i++) {
+        int16_t mx = (i < 4) ? 60 : 180;
+        int16_t my = 240 - (i % 4) * 60;
+        ST7789_DrawRectangle(mx, my, 20, 10, ST7789_BROWN);
+        Sprite_Draw(&sprite_mole, mx + 3, my + 10);
+    }
+    Sprite_Draw(mallet, x, y);
+    display_drawString(20, 20, "SCORE:12", 8, ST7789_WHITE, background, 2);
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-ppm")) {
+            writePPM = 1;
+        } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+            outDir = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [-o dir] [-ppm]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    printf("%-14s %7s %7s %7s %8s %8s %8s %8s %8s\n", "frame", "windows", "cmds", "params",
+           "pixels", "bytes", "driver", "bus ms", "busy ms");
+
+    ST7789Emu_Reset();
+    ST7789_Init();
+    Host_EndFrame("init");
+
+    // The same scene in both interface formats, 12-bit only loses depth
+    ST7789_Fill(ST7789_BLACK);
+    Host_Scene();
+    Host_OddRuns();
+    Host_Capture();
+    Host_EndFrame("gfx16");
+
+    ST7789_SetColorDepth(ST7789_COLOR_12BIT);
+    ST7789_Fill(ST7789_BLACK);
+    Host_Scene();
+    Host_OddRuns();
+    Host_Compare("gfx12 vs gfx16", HOST_TOLERANCE_444);
+    Host_EndFrame("gfx12");
+    ST7789_SetColorDepth(ST7789_COLOR_16BIT);
+
+    Host_DMACheck(ST7789_COLOR_16BIT);
+    Host_DMACheck(ST7789_COLOR_12BIT);
+
+    Host_QueryCheck();
+
+    Host_Sprites(0);
+    Host_Capture();
+    Host_EndFrame("sprites");
+
+    Host_Sprites(1);
+    Host_Compare("sprite compose vs draw", 0);
+    Host_EndFrame("sprites_tiles");
+
+    // Game screen drawn directly, then through the tile renderer, then one
+    // mallet move through each. The frames must match exactly and the
+    // table shows what each path costs on the bus.
+    Host_GameImmediate(&sprite_mallet, 117, 160);
+    Host_Capture();
+    Host_EndFrame("immediate");
+
+    TileRenderer_Init(background);
+    for (int i = 0; i < 8; i++) {
+        int16_t x = (i < 4) ? 60 : 180;
+        int16_t y = 240 - (i % 4) * 60;
+        TileRenderer_AddRect(x, y, 20, 10, ST7789_BROWN);
+        TileRenderer_AddSprite(x + 3, y + 10, &sprite_mole);
+    }
+    int32_t mallet = TileRenderer_AddSprite(117, 160, &sprite_mallet);
+    TileRenderer_AddText(20, 20, "SCORE:12", ST7789_WHITE, background, 2);
+    TileRenderer_InvalidateAll();
+    TileRenderer_Flush();
+    Host_Compare("tiles vs immediate", 0);
+    Host_EndFrame("tiles");
+
+    TileRenderer_SetSprite(mallet, &sprite_mallet_hit);
+    TileRenderer_SetRect(mallet, 120, 156, 0, 0);
+    TileRenderer_Flush();
+    Host_Capture();
+    Host_EndFrame("tiles_move");
+
+    Host_GameImmediate(&sprite_mallet_hit, 120, 156);
+    Host_Compare("immediate vs tiles_move", 0);
+    Host_EndFrame("immediate_move");
+
+    return failures ? 1 : 0;
+}
+
+/********************************Public Functions***********************************/